@@ -0,0 +1,314 @@
+/**
+ * @file Projection.h
+ * @ingroup cad
+ *
+ * The projection phase of a cylindrical algebraic decomposition.
+ *
+ * The polynomials are organized in levels according to a fixed variable ordering.
+ * A polynomial lives on the level of its largest variable and is stored as a univariate polynomial in this variable.
+ * Projecting a level yields polynomials in the smaller variables only, which are split into their irreducible factors
+ * and added to the respective lower levels.
+ */
+
+#pragma once
+
+#include "../config.h"
+#include "../core/logging.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/UnivariatePolynomial.h"
+#include "../core/polynomialfunctions/Factorization.h"
+#include "../core/polynomialfunctions/Resultant.h"
+#include "../core/polynomialfunctions/SquareFreePart.h"
+#include "../util/LRUCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace carl {
+namespace cad {
+
+/**
+ * Projection operators.
+ * - McCallum: all coefficients (up to the first constant one), discriminants and resultants.
+ * - Lazard: leading and trailing coefficients, discriminants and resultants.
+ */
+enum class ProjectionType {
+	McCallum, Lazard
+};
+
+inline std::ostream& operator<<(std::ostream& os, ProjectionType type) {
+	switch (type) {
+		case ProjectionType::McCallum: return os << "McCallum";
+		case ProjectionType::Lazard: return os << "Lazard";
+	}
+	return os << "Unknown projection";
+}
+
+/**
+ * Caches the decomposition of polynomials into normalized, square-free and (as far as the available backends allow) irreducible factors.
+ * The same projection polynomials tend to show up over and over again, hence every polynomial is only decomposed once.
+ */
+template<typename Poly>
+class ProjectionFactorCache {
+private:
+	LRUCache<Poly, std::shared_ptr<const std::vector<Poly>>> mFactors;
+
+	static std::shared_ptr<const std::vector<Poly>> decompose(const Poly& p) {
+		auto res = std::make_shared<std::vector<Poly>>();
+		if (p.isConstant()) return res;
+		for (const auto& f: carl::factorization(p, false)) {
+			if (f.first.isConstant()) continue;
+			Poly factor = carl::squareFreePart(f.first).normalize();
+			if (std::find(res->begin(), res->end(), factor) == res->end()) {
+				res->push_back(factor);
+			}
+		}
+		return res;
+	}
+public:
+	ProjectionFactorCache():
+		mFactors(LRUCache<Poly, std::shared_ptr<const std::vector<Poly>>>::unbounded)
+	{}
+	/**
+	 * Returns the non-constant factors of the given polynomial, each normalized to a leading coefficient of one.
+	 * The returned reference stays valid until clear() is called.
+	 */
+	const std::vector<Poly>& factors(const Poly& p) {
+		return *mFactors.get(p, &ProjectionFactorCache::decompose);
+	}
+	std::size_t size() const {
+		return mFactors.size();
+	}
+	std::size_t hits() const {
+		return mFactors.hits();
+	}
+	std::size_t misses() const {
+		return mFactors.misses();
+	}
+	void clear() {
+		mFactors.clear();
+	}
+};
+
+/**
+ * Incremental projection with respect to a fixed variable ordering.
+ *
+ * Polynomials can be added at any time with addPolynomial().
+ * A call to project() then only computes the projection polynomials that involve polynomials added since the last call,
+ * that is their own coefficients and discriminants and their resultants with all other polynomials on the same level.
+ * All projection polynomials are deduplicated: every factor is stored exactly once, on the level of its largest variable.
+ *
+ * The individual projection operations of a level are independent of each other and can be computed by multiple threads.
+ * The result does not depend on the number of threads.
+ */
+template<typename Poly>
+class Projection {
+public:
+	using UPoly = UnivariatePolynomial<Poly>;
+private:
+	/// The variable ordering, the polynomials on level i have the main variable mVariables[i].
+	std::vector<Variable> mVariables;
+	ProjectionType mType;
+	SubresultantStrategy mStrategy;
+	std::size_t mThreads = 1;
+	ProjectionFactorCache<Poly> mFactorCache;
+	/// The polynomials of every level.
+	std::vector<std::vector<UPoly>> mPolynomials;
+	/// Maps every known polynomial to its level.
+	std::unordered_map<Poly, std::size_t> mPool;
+	/// For every level, the number of polynomials that have already been projected.
+	std::vector<std::size_t> mProjected;
+	std::size_t mResultants = 0;
+	std::size_t mDiscriminants = 0;
+
+	/// A single projection operation on some level.
+	struct Job {
+		std::size_t first;
+		std::size_t second;
+	};
+
+	std::size_t levelOf(const Poly& p) const {
+		std::size_t level = 0;
+		bool found = false;
+		for (auto v: p.gatherVariables()) {
+			auto it = std::find(mVariables.begin(), mVariables.end(), v);
+			assert(it != mVariables.end());
+			level = std::max(level, std::size_t(std::distance(mVariables.begin(), it)));
+			found = true;
+		}
+		assert(found);
+		return level;
+	}
+
+	/// Adds all factors of p to the pool.
+	void insert(const Poly& p) {
+		for (const auto& f: mFactorCache.factors(p)) {
+			if (mPool.find(f) != mPool.end()) continue;
+			std::size_t level = levelOf(f);
+			mPool.emplace(f, level);
+			CARL_LOG_DEBUG("carl.cad", "Adding " << f << " to level " << level);
+			mPolynomials[level].push_back(f.toUnivariatePolynomial(mVariables[level]));
+		}
+	}
+
+	/// Computes the projection polynomials of a single polynomial.
+	std::vector<Poly> project(const UPoly& p) const {
+		std::vector<Poly> res;
+		const auto& coeffs = p.coefficients();
+		switch (mType) {
+			case ProjectionType::McCallum:
+				for (auto it = coeffs.rbegin(); it != coeffs.rend(); it++) {
+					if (it->isZero()) continue;
+					// A constant coefficient never vanishes, the remaining ones are not needed.
+					if (it->isConstant()) break;
+					res.push_back(*it);
+				}
+				break;
+			case ProjectionType::Lazard:
+				res.push_back(p.lcoeff());
+				res.push_back(p.tcoeff());
+				break;
+		}
+		if (p.degree() > 1) {
+			res.emplace_back(carl::discriminant(p, mStrategy));
+		}
+		return res;
+	}
+
+	/// Computes the projection polynomials of a pair of polynomials.
+	std::vector<Poly> project(const UPoly& p, const UPoly& q) const {
+		return { Poly(carl::resultant(p, q, mStrategy)) };
+	}
+
+	/**
+	 * Executes the given jobs of a level and returns the factors of their projection polynomials, ordered by jobs.
+	 * If there are multiple threads, every thread takes the next unprocessed job.
+	 */
+	std::vector<std::vector<Poly>> execute(std::size_t level, const std::vector<Job>& jobs) {
+		const auto& polys = mPolynomials[level];
+		std::vector<std::vector<Poly>> results(jobs.size());
+		std::atomic<std::size_t> next(0);
+		auto worker = [&]() {
+			for (std::size_t i = next++; i < jobs.size(); i = next++) {
+				const Job& job = jobs[i];
+				auto projection = (job.first == job.second) ? project(polys[job.first]) : project(polys[job.first], polys[job.second]);
+				for (const auto& p: projection) {
+					for (const auto& f: mFactorCache.factors(p)) {
+						results[i].push_back(f);
+					}
+				}
+			}
+		};
+#ifdef THREAD_SAFE
+		std::size_t threads = std::min(mThreads, jobs.size());
+		if (threads > 1) {
+			std::vector<std::thread> pool;
+			for (std::size_t t = 0; t < threads; t++) {
+				pool.emplace_back(worker);
+			}
+			for (auto& t: pool) t.join();
+			return results;
+		}
+#endif
+		worker();
+		return results;
+	}
+public:
+	/**
+	 * Creates a projection for the given variable ordering.
+	 * The first variable is the one that remains after projecting all others.
+	 */
+	explicit Projection(const std::vector<Variable>& variables, ProjectionType type = ProjectionType::McCallum, SubresultantStrategy strategy = SubresultantStrategy::Default):
+		mVariables(variables),
+		mType(type),
+		mStrategy(strategy),
+		mPolynomials(variables.size()),
+		mProjected(variables.size(), 0)
+	{}
+
+	/**
+	 * Sets the number of threads used by project().
+	 * Without THREAD_SAFE, the projection is always computed sequentially.
+	 */
+	void setThreads(std::size_t threads) {
+		mThreads = std::max(threads, std::size_t(1));
+	}
+	std::size_t threads() const {
+		return mThreads;
+	}
+	ProjectionType type() const {
+		return mType;
+	}
+	std::size_t dimension() const {
+		return mVariables.size();
+	}
+	Variable variable(std::size_t level) const {
+		assert(level < mVariables.size());
+		return mVariables[level];
+	}
+	/// Returns the polynomials on the given level.
+	const std::vector<UPoly>& polynomials(std::size_t level) const {
+		assert(level < mPolynomials.size());
+		return mPolynomials[level];
+	}
+	/// Returns the overall number of polynomials on all levels.
+	std::size_t size() const {
+		return mPool.size();
+	}
+	/// Checks whether the given polynomial, up to normalization, is part of the projection.
+	bool contains(const Poly& p) const {
+		return mPool.find(p.normalize()) != mPool.end();
+	}
+	std::size_t resultants() const {
+		return mResultants;
+	}
+	std::size_t discriminants() const {
+		return mDiscriminants;
+	}
+	const ProjectionFactorCache<Poly>& factorCache() const {
+		return mFactorCache;
+	}
+
+	/**
+	 * Adds a polynomial, more precisely all its factors, to the projection.
+	 * The projection polynomials are computed upon the next call to project().
+	 */
+	void addPolynomial(const Poly& p) {
+		CARL_LOG_DEBUG("carl.cad", "Adding input polynomial " << p);
+		insert(p);
+	}
+
+	/**
+	 * Computes all projection polynomials that are not yet known.
+	 * The levels are processed from top to bottom, as projecting a level only adds polynomials to lower levels.
+	 */
+	void project() {
+		for (std::size_t level = mVariables.size(); level-- > 1; ) {
+			const auto& polys = mPolynomials[level];
+			std::vector<Job> jobs;
+			for (std::size_t i = mProjected[level]; i < polys.size(); i++) {
+				jobs.push_back(Job{ i, i });
+				if (polys[i].degree() > 1) mDiscriminants++;
+				for (std::size_t j = 0; j < i; j++) {
+					jobs.push_back(Job{ j, i });
+					mResultants++;
+				}
+			}
+			mProjected[level] = polys.size();
+			if (jobs.empty()) continue;
+			CARL_LOG_DEBUG("carl.cad", "Projecting level " << level << " with " << jobs.size() << " operations");
+			for (const auto& factors: execute(level, jobs)) {
+				for (const auto& f: factors) insert(f);
+			}
+		}
+		mProjected[0] = mPolynomials[0].size();
+	}
+};
+
+}
+}
@@ -0,0 +1,256 @@
+/**
+ * @file CompiledHorner.h
+ *
+ * A flat representation of Horner schemes and a global cache for them.
+ *
+ * MultivariateHorner represents a Horner scheme as a tree of shared pointers, which is expensive to build and slow to traverse.
+ * CompiledHorner stores the same scheme as a contiguous postfix program for a small stack machine,
+ * such that evaluation in double, interval or exact arithmetic is a single loop over an array.
+ */
+
+#pragma once
+
+#include "../config.h"
+#include "../interval/Interval.h"
+#include "../interval/IntervalBox.h"
+#include "../util/LRUCache.h"
+#include "../util/Singleton.h"
+#include "MultivariateHorner.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace carl {
+
+template<typename Polynomial>
+class CompiledHorner {
+public:
+	using Coeff = typename Polynomial::CoeffType;
+private:
+	enum class Opcode {
+		/// Pushes constant[arg].
+		Constant,
+		/// Pushes variable[arg]^exponent.
+		Power,
+		/// Replaces the two topmost values by their sum.
+		Add,
+		/// Replaces the two topmost values by their product.
+		Mul,
+		/// Adds constant[arg] to the topmost value.
+		AddConstant,
+		/// Multiplies the topmost value with constant[arg].
+		MulConstant
+	};
+	struct Instruction {
+		Opcode op;
+		std::size_t arg;
+		uint exponent;
+	};
+
+	std::vector<Instruction> mInstructions;
+	std::vector<Variable> mVariables;
+	std::vector<Coeff> mConstants;
+	std::vector<double> mDoubleConstants;
+	std::vector<Interval<double>> mIntervalConstants;
+	std::size_t mStackSize = 0;
+
+	std::size_t variableIndex(Variable::Arg v) {
+		auto it = std::find(mVariables.begin(), mVariables.end(), v);
+		if (it != mVariables.end()) return std::size_t(it - mVariables.begin());
+		mVariables.push_back(v);
+		return mVariables.size() - 1;
+	}
+	std::size_t constantIndex(const Coeff& c) {
+		mConstants.push_back(c);
+		mDoubleConstants.push_back(carl::toDouble(c));
+		mIntervalConstants.emplace_back(c);
+		return mConstants.size() - 1;
+	}
+
+	/// Compiles h = variable^exponent * dependent + independent, the result is one value on top of the stack.
+	template<typename Strategy>
+	void compile(const MultivariateHorner<Polynomial, Strategy>& h, std::size_t depth) {
+		mStackSize = std::max(mStackSize, depth + 1);
+		if (h.getVariable() == Variable::NO_VARIABLE) {
+			mInstructions.push_back(Instruction{ Opcode::Constant, constantIndex(h.getIndepConstant()), 0 });
+			return;
+		}
+		mInstructions.push_back(Instruction{ Opcode::Power, variableIndex(h.getVariable()), h.getExponent() });
+		if (h.getDependent()) {
+			compile(*h.getDependent(), depth + 1);
+			mInstructions.push_back(Instruction{ Opcode::Mul, 0, 0 });
+		} else if (!carl::isOne(h.getDepConstant())) {
+			mInstructions.push_back(Instruction{ Opcode::MulConstant, constantIndex(h.getDepConstant()), 0 });
+		}
+		if (h.getIndependent()) {
+			compile(*h.getIndependent(), depth + 1);
+			mInstructions.push_back(Instruction{ Opcode::Add, 0, 0 });
+		} else if (!carl::isZero(h.getIndepConstant())) {
+			mInstructions.push_back(Instruction{ Opcode::AddConstant, constantIndex(h.getIndepConstant()), 0 });
+		}
+	}
+
+	const std::vector<double>& constants(const double*) const {
+		return mDoubleConstants;
+	}
+	const std::vector<Interval<double>>& constants(const Interval<double>*) const {
+		return mIntervalConstants;
+	}
+	const std::vector<Coeff>& constants(const Coeff*) const {
+		return mConstants;
+	}
+
+	static double power(double d, uint exp) {
+		return std::pow(d, exp);
+	}
+	static Interval<double> power(const Interval<double>& i, uint exp) {
+		return i.pow(exp);
+	}
+	static Coeff power(const Coeff& c, uint exp) {
+		return carl::pow(c, exp);
+	}
+
+	/**
+	 * Returns a buffer with at least the given number of elements.
+	 * The buffers are reused by all evaluations within the current thread, hence evaluation does not allocate memory.
+	 * Every Tag denotes a separate buffer.
+	 */
+	template<typename T, int Tag>
+	static T* buffer(std::size_t size) {
+		thread_local std::vector<T> buf;
+		if (buf.size() < size) buf.resize(size);
+		return buf.data();
+	}
+
+	/// Runs the program, values are aligned with variables().
+	template<typename T>
+	T run(const T* values) const {
+		const auto& constant = constants(values);
+		T* stack = buffer<T, 0>(mStackSize);
+		std::size_t top = 0;
+		for (const auto& i: mInstructions) {
+			switch (i.op) {
+				case Opcode::Constant:
+					stack[top++] = constant[i.arg];
+					break;
+				case Opcode::Power:
+					stack[top++] = (i.exponent == 1) ? values[i.arg] : power(values[i.arg], i.exponent);
+					break;
+				case Opcode::Add:
+					top--;
+					stack[top-1] = stack[top-1] + stack[top];
+					break;
+				case Opcode::Mul:
+					top--;
+					stack[top-1] = stack[top-1] * stack[top];
+					break;
+				case Opcode::AddConstant:
+					stack[top-1] = stack[top-1] + constant[i.arg];
+					break;
+				case Opcode::MulConstant:
+					stack[top-1] = stack[top-1] * constant[i.arg];
+					break;
+			}
+		}
+		assert(top == 1);
+		return stack[0];
+	}
+
+	template<typename T, typename Map>
+	T runOn(const Map& map) const {
+		T* values = buffer<T, 1>(mVariables.size());
+		for (std::size_t i = 0; i < mVariables.size(); i++) values[i] = map.at(mVariables[i]);
+		return run(values);
+	}
+public:
+	/// Compiles the given Horner scheme.
+	template<typename Strategy>
+	explicit CompiledHorner(const MultivariateHorner<Polynomial, Strategy>& h) {
+		compile(h, 0);
+	}
+	/// Builds a Horner scheme using the given strategy and compiles it.
+	explicit CompiledHorner(const Polynomial& p) {
+		compile(MultivariateHorner<Polynomial, strategy>(p), 0);
+	}
+
+	/// The variables of the scheme, which determine the order of the values passed to evaluate().
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Number of instructions.
+	std::size_t size() const {
+		return mInstructions.size();
+	}
+
+	/**
+	 * Evaluates the scheme, where values[i] is the value of variables()[i].
+	 * Evaluation in double is not rigorous, use intervals to obtain a valid enclosure.
+	 */
+	double evaluate(const std::vector<double>& values) const {
+		assert(values.size() == mVariables.size());
+		return run(values.data());
+	}
+	Interval<double> evaluate(const std::vector<Interval<double>>& values) const {
+		assert(values.size() == mVariables.size());
+		return run(values.data());
+	}
+	Coeff evaluate(const std::vector<Coeff>& values) const {
+		assert(values.size() == mVariables.size());
+		return run(values.data());
+	}
+
+	/// Evaluates the scheme on the given assignment, which must contain all variables().
+	template<typename T>
+	T evaluate(const std::map<Variable, T>& map) const {
+		return runOn<T>(map);
+	}
+	Interval<double> evaluate(const IntervalBox<double>& box) const {
+		return runOn<Interval<double>>(box);
+	}
+};
+
+/**
+ * A bounded global cache of compiled Horner schemes, keyed by the polynomial.
+ * The variable ordering of the schemes is determined by the Strategy, hence every Strategy has its own cache.
+ * If the cache is full, the least recently used scheme is dropped; schemes stay valid as long as someone holds a reference to them.
+ */
+template<typename Polynomial, typename Strategy = strategy>
+class HornerSchemeCache: public Singleton<HornerSchemeCache<Polynomial, Strategy>> {
+	friend Singleton<HornerSchemeCache<Polynomial, Strategy>>;
+public:
+	using Scheme = CompiledHorner<Polynomial>;
+	using SchemePtr = std::shared_ptr<const Scheme>;
+private:
+	LRUCache<Polynomial, SchemePtr> mCache;
+public:
+	explicit HornerSchemeCache(std::size_t maxSize = 1024):
+		mCache(maxSize)
+	{}
+
+	/// Returns the compiled Horner scheme of the given polynomial, building it if it is not cached.
+	SchemePtr get(const Polynomial& p) {
+		return mCache.get(p, [](const Polynomial& q) -> SchemePtr {
+			return std::make_shared<const Scheme>(MultivariateHorner<Polynomial, Strategy>(q));
+		});
+	}
+
+	void setMaxSize(std::size_t maxSize) {
+		mCache.setMaxSize(maxSize);
+	}
+	std::size_t size() const {
+		return mCache.size();
+	}
+	std::size_t hits() const {
+		return mCache.hits();
+	}
+	std::size_t misses() const {
+		return mCache.misses();
+	}
+	void clear() {
+		mCache.clear();
+	}
+};
+
+}
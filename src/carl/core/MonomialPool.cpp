@@ -29,6 +29,12 @@ namespace carl
 			res->mId = mIDs.get();
 		} else {
 			res = iter.first->monomial.lock();
+			if (!res) {
+				// The monomial has expired, but its destructor did not yet remove it from the pool.
+				res = Monomial::Arg(new Monomial(iter.first->hash, iter.first->content));
+				res->mId = mIDs.get();
+				iter.first->monomial = res;
+			}
 		}
 		return res;
 	}
@@ -41,10 +47,15 @@ namespace carl
 		if (iter.second) {
 			_monomial->mId = mIDs.get();
 			return _monomial;
-		} else {
-			assert(_monomial == iter.first->monomial.lock());
-			return iter.first->monomial.lock();
 		}
+		Monomial::Arg res = iter.first->monomial.lock();
+		if (!res) {
+			// The monomial has expired, but its destructor did not yet remove it from the pool.
+			_monomial->mId = mIDs.get();
+			iter.first->monomial = _monomial;
+			return _monomial;
+		}
+		return res;
 	}
 #else
 	Monomial::Arg MonomialPool::add( MonomialPool::PoolEntry&& pe, exponent totalDegree) {
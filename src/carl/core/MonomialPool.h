@@ -121,7 +121,8 @@ namespace carl{
 				auto it = mPool.find(pe);
 				if (it != mPool.end()) {
 					mIDs.free(m->id());
-					mPool.erase(it);
+					// Another thread may have replaced the expired monomial in the meantime.
+					if (it->monomial.expired()) mPool.erase(it);
 				}
 			}
 
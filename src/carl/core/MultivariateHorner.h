@@ -47,6 +47,8 @@ public:
     MultivariateHorner () = delete;
 	MultivariateHorner (const PolynomialType& inPut);
 	MultivariateHorner (const PolynomialType& inPut, const std::map<Variable, Interval<double>>& map);
+	/// Uses the intervals of the given box for the variable selection heuristics, like the constructor taking a map.
+	MultivariateHorner (const PolynomialType& inPut, const IntervalBox<double>& box);
 	MultivariateHorner (const PolynomialType& inPut, const std::map<Variable, Interval<double>>& map, int& counter);
     MultivariateHorner ( const MultivariateHorner& ) = default;
 #ifdef __VS
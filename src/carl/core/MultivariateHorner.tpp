@@ -85,8 +85,10 @@ namespace carl
 		std::cout << __func__ << " (GreedyII constr) P: " << inPut << std::endl;
 	#endif
 
+	int arithmeticOperationsReductionCounter = 0;
+
 	//Create Horner Scheme Recursivly
-	MultivariateHorner< PolynomialType, strategy > root (std::move(inPut), true, map);
+	MultivariateHorner< PolynomialType, strategy > root (std::move(inPut), map, arithmeticOperationsReductionCounter);
 
  	//Part after recursion
  	if (strategy::selectionType == variableSelectionHeurisics::GREEDY_Is || strategy::selectionType == variableSelectionHeurisics::GREEDY_IIs)
@@ -101,6 +103,13 @@ namespace carl
 	}
 
 
+	//Constructor for Greedy II and Greedy I on a box
+	template< typename PolynomialType, typename strategy >
+	MultivariateHorner< PolynomialType, strategy>::MultivariateHorner (const PolynomialType& inPut, const IntervalBox<double>& box):
+		MultivariateHorner(inPut, box.toMap())
+	{}
+
+
 	//Constructor for Greedy I/II creates recursive Datastruckture
 	template< typename PolynomialType, typename strategy >
 	MultivariateHorner< PolynomialType, strategy>::MultivariateHorner (const PolynomialType& inPut, const std::map<Variable, Interval<double>>& map, int& counter)
@@ -0,0 +1,194 @@
+/**
+ * @file PolynomialPool.h
+ *
+ * A pool of hash-consed polynomials, such that equal polynomials are stored only once.
+ */
+
+#pragma once
+
+#include "../util/Singleton.h"
+#include "MonomialPool.h"
+
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+	template<typename Pol>
+	class PolynomialPool;
+
+	/**
+	 * A handle to an immutable polynomial stored in the PolynomialPool.
+	 * As equal polynomials are represented by the same pool entry, handles are compared by their pointers
+	 * and the hash value is computed only once, when the polynomial enters the pool.
+	 * The ordering of handles is the order in which the polynomials entered the pool, not an ordering of polynomials.
+	 * A default constructed handle does not refer to any polynomial.
+	 */
+	template<typename Pol>
+	class PooledPolynomial
+	{
+		friend class PolynomialPool<Pol>;
+		private:
+			struct Content {
+				Pol polynomial;
+				std::size_t hash;
+				std::size_t id;
+			};
+			std::shared_ptr<const Content> mContent;
+
+			explicit PooledPolynomial(std::shared_ptr<const Content> content): mContent(std::move(content)) {}
+		public:
+			PooledPolynomial() = default;
+			/**
+			 * Looks up the given polynomial in the pool, adding it if necessary.
+			 */
+			explicit PooledPolynomial(const Pol& p);
+			explicit PooledPolynomial(Pol&& p);
+
+			const Pol& get() const {
+				assert(mContent);
+				return mContent->polynomial;
+			}
+			const Pol& operator*() const {
+				return get();
+			}
+			const Pol* operator->() const {
+				return &get();
+			}
+			std::size_t hash() const {
+				return mContent ? mContent->hash : 0;
+			}
+			/// A unique id of the pool entry, zero for an empty handle.
+			std::size_t id() const {
+				return mContent ? mContent->id : 0;
+			}
+			explicit operator bool() const {
+				return bool(mContent);
+			}
+
+			bool operator==(const PooledPolynomial& rhs) const {
+				return mContent == rhs.mContent;
+			}
+			bool operator!=(const PooledPolynomial& rhs) const {
+				return mContent != rhs.mContent;
+			}
+			bool operator<(const PooledPolynomial& rhs) const {
+				return id() < rhs.id();
+			}
+	};
+
+	template<typename Pol>
+	inline std::ostream& operator<<(std::ostream& os, const PooledPolynomial<Pol>& p) {
+		if (!p) return os << "null";
+		return os << *p;
+	}
+
+	/**
+	 * The pool of hash-consed polynomials of type Pol, which must provide std::hash and operator==.
+	 * Using the pool is optional: polynomials only enter the pool if a PooledPolynomial is created for them.
+	 * The pool does not own the polynomials, an entry is removed as soon as its last handle is destroyed.
+	 */
+	template<typename Pol>
+	class PolynomialPool : public Singleton<PolynomialPool<Pol>>
+	{
+		friend class Singleton<PolynomialPool<Pol>>;
+		using Content = typename PooledPolynomial<Pol>::Content;
+		private:
+			/// The entries by their hash. The raw pointer identifies an entry after its last handle was destroyed.
+			std::unordered_multimap<std::size_t, std::pair<const Content*, std::weak_ptr<const Content>>> mPool;
+			/// The id of the next entry.
+			std::size_t mNextID = 1;
+			/// Mutex to avoid multiple access to the pool
+			mutable std::recursive_mutex mMutex;
+
+			#ifdef THREAD_SAFE
+			#define POLYNOMIAL_POOL_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutex );
+			#else
+			#define POLYNOMIAL_POOL_LOCK_GUARD
+			#endif
+
+			/**
+			 * Makes sure that the MonomialPool is created before and thus destroyed after this pool.
+			 */
+			PolynomialPool() {
+				MonomialPool::getInstance();
+			}
+
+			/**
+			 * Removes the entry from the pool, called when the last handle is destroyed.
+			 */
+			void free(const Content* content) {
+				{
+					POLYNOMIAL_POOL_LOCK_GUARD
+					auto range = mPool.equal_range(content->hash);
+					for (auto it = range.first; it != range.second; ++it) {
+						if (it->second.first == content) {
+							mPool.erase(it);
+							break;
+						}
+					}
+				}
+				delete content;
+			}
+		public:
+			/**
+			 * @return The handle of the given polynomial.
+			 */
+			PooledPolynomial<Pol> create(Pol&& p) {
+				std::size_t hash = std::hash<Pol>()(p);
+				// Entries whose last handle is destroyed while the pool is locked would be removed during the iteration.
+				// Hence, the entries are only released after the lock.
+				std::vector<std::shared_ptr<const Content>> visited;
+				POLYNOMIAL_POOL_LOCK_GUARD
+				auto range = mPool.equal_range(hash);
+				for (auto it = range.first; it != range.second; ++it) {
+					std::shared_ptr<const Content> content = it->second.second.lock();
+					if (!content) continue;
+					if (content->polynomial == p) return PooledPolynomial<Pol>(std::move(content));
+					visited.push_back(std::move(content));
+				}
+				const Content* content = new Content{std::move(p), hash, mNextID++};
+				std::shared_ptr<const Content> res(content, [](const Content* c){ PolynomialPool<Pol>::getInstance().free(c); });
+				mPool.emplace(hash, std::make_pair(content, std::weak_ptr<const Content>(res)));
+				return PooledPolynomial<Pol>(std::move(res));
+			}
+			PooledPolynomial<Pol> create(const Pol& p) {
+				return create(Pol(p));
+			}
+
+			/// Number of polynomials in the pool.
+			std::size_t size() const {
+				POLYNOMIAL_POOL_LOCK_GUARD
+				return mPool.size();
+			}
+	};
+
+	template<typename Pol>
+	PooledPolynomial<Pol>::PooledPolynomial(const Pol& p):
+		PooledPolynomial(PolynomialPool<Pol>::getInstance().create(p))
+	{}
+
+	template<typename Pol>
+	PooledPolynomial<Pol>::PooledPolynomial(Pol&& p):
+		PooledPolynomial(PolynomialPool<Pol>::getInstance().create(std::move(p)))
+	{}
+}
+
+namespace std
+{
+	/**
+	 * Specialization of `std::hash` for handles of pooled polynomials, which returns the cached hash.
+	 */
+	template<typename Pol>
+	struct hash<carl::PooledPolynomial<Pol>> {
+		std::size_t operator()(const carl::PooledPolynomial<Pol>& p) const {
+			return p.hash();
+		}
+	};
+}
@@ -0,0 +1,160 @@
+/**
+ * @file SignFilter.h
+ * @ingroup unirp
+ *
+ * Floating point filter for sign evaluations of univariate polynomials.
+ *
+ * The polynomial is evaluated in interval arithmetic over double, where every operation is rounded outwards.
+ * If the resulting enclosure does not contain zero, its sign is the sign of the exact value.
+ * Otherwise, the caller has to fall back to an exact evaluation.
+ */
+
+#pragma once
+
+#include "../numbers/numbers.h"
+#include "../util/Singleton.h"
+#include "Sign.h"
+
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Collects statistics about how often the floating point sign filter was able to decide a sign.
+ */
+class SignFilterStatistics: public Singleton<SignFilterStatistics> {
+	friend Singleton<SignFilterStatistics>;
+private:
+	std::atomic<std::size_t> mSucceeded;
+	std::atomic<std::size_t> mFailed;
+	SignFilterStatistics(): mSucceeded(0), mFailed(0) {}
+public:
+	/// Count that the filter decided the sign.
+	void success() {
+		mSucceeded.fetch_add(1, std::memory_order_relaxed);
+	}
+	/// Count that the filter was inconclusive and an exact evaluation was necessary.
+	void failure() {
+		mFailed.fetch_add(1, std::memory_order_relaxed);
+	}
+	std::size_t succeeded() const {
+		return mSucceeded.load(std::memory_order_relaxed);
+	}
+	std::size_t failed() const {
+		return mFailed.load(std::memory_order_relaxed);
+	}
+	std::size_t calls() const {
+		return succeeded() + failed();
+	}
+	void reset() {
+		mSucceeded = 0;
+		mFailed = 0;
+	}
+};
+
+namespace signfilter {
+	/// A closed interval over double used for the filtered evaluation.
+	struct Enclosure {
+		double lower;
+		double upper;
+	};
+
+	inline double down(double d) {
+		return std::nextafter(d, -std::numeric_limits<double>::infinity());
+	}
+	inline double up(double d) {
+		return std::nextafter(d, std::numeric_limits<double>::infinity());
+	}
+
+	/**
+	 * Encloses a number by an interval of doubles.
+	 * The conversion to double is accurate up to one ulp, hence widening by one ulp in both directions suffices.
+	 */
+	template<typename Number>
+	inline Enclosure enclose(const Number& n) {
+		if (carl::isZero(n)) return Enclosure{ 0, 0 };
+		double d = carl::toDouble(n);
+		return Enclosure{ down(d), up(d) };
+	}
+	/// Encloses the closed interval between the two given numbers.
+	template<typename Number>
+	inline Enclosure enclose(const Number& lower, const Number& upper) {
+		return Enclosure{ enclose(lower).lower, enclose(upper).upper };
+	}
+
+	inline Enclosure add(const Enclosure& a, const Enclosure& b) {
+		return Enclosure{ down(a.lower + b.lower), up(a.upper + b.upper) };
+	}
+
+	inline Enclosure mul(const Enclosure& a, const Enclosure& b) {
+		double ll = a.lower * b.lower;
+		double lu = a.lower * b.upper;
+		double ul = a.upper * b.lower;
+		double uu = a.upper * b.upper;
+		return Enclosure{
+			down(std::min(std::min(ll, lu), std::min(ul, uu))),
+			up(std::max(std::max(ll, lu), std::max(ul, uu)))
+		};
+	}
+
+	/**
+	 * Evaluates the polynomial given by its coefficients (lowest degree first) over the given enclosure using Horner's scheme.
+	 * @return The sign of the polynomial on the enclosure, if it is decided.
+	 */
+	template<typename Number>
+	boost::optional<Sign> hornerSign(const std::vector<Number>& coefficients, const Enclosure& x) {
+		if (coefficients.empty()) return Sign::ZERO;
+		Enclosure res = enclose(coefficients.back());
+		for (auto it = std::next(coefficients.rbegin()); it != coefficients.rend(); it++) {
+			res = add(mul(res, x), enclose(*it));
+		}
+		// NaN fails both comparisons and thereby also ends up here.
+		if (!(std::isfinite(res.lower) && std::isfinite(res.upper))) return boost::none;
+		if (res.lower > 0) return Sign::POSITIVE;
+		if (res.upper < 0) return Sign::NEGATIVE;
+		return boost::none;
+	}
+}
+
+/**
+ * Computes the sign of the polynomial given by its coefficients (lowest degree first) at the given value.
+ * The floating point filter is tried first, the exact evaluation is only used if the filter is inconclusive.
+ * @param coefficients Coefficients of the polynomial.
+ * @param value Point to evaluate at.
+ * @param exact Callable that evaluates the sign exactly.
+ * @return Sign of the polynomial at value.
+ */
+template<typename Number, typename Exact>
+Sign filteredSign(const std::vector<Number>& coefficients, const Number& value, Exact&& exact) {
+	auto res = signfilter::hornerSign(coefficients, signfilter::enclose(value));
+	if (res) {
+		SignFilterStatistics::getInstance().success();
+		return *res;
+	}
+	SignFilterStatistics::getInstance().failure();
+	return exact();
+}
+
+/**
+ * Tries to determine the sign of the polynomial given by its coefficients (lowest degree first) on the closed interval [lower, upper].
+ * If the sign is not constant on the whole interval or the filter is inconclusive, nothing is returned.
+ * @param coefficients Coefficients of the polynomial.
+ * @param lower Lower bound of the interval.
+ * @param upper Upper bound of the interval.
+ * @return Sign of the polynomial on the interval, if it could be decided.
+ */
+template<typename Number>
+boost::optional<Sign> filteredIntervalSign(const std::vector<Number>& coefficients, const Number& lower, const Number& upper) {
+	auto res = signfilter::hornerSign(coefficients, signfilter::enclose(lower, upper));
+	if (res) SignFilterStatistics::getInstance().success();
+	else SignFilterStatistics::getInstance().failure();
+	return res;
+}
+
+}
@@ -9,8 +9,10 @@
 #include "../interval/Interval.h"
 #include "../numbers/numbers.h"
 #include "../util/SFINAE.h"
+#include "../util/hash.h"
 #include "Polynomial.h"
 #include "Sign.h"
+#include "SignFilter.h"
 #include "Variable.h"
 #include "VariableInformation.h"
 
@@ -751,9 +753,15 @@ public:
 
 	/**
 	 * Calculates the sign of the polynomial at some point.
+	 * For rational coefficients, the sign is first determined by a floating point filter (see SignFilter.h) and only evaluated exactly if the filter is inconclusive.
 	 * @param value Point to evaluate.
 	 * @return Sign at value.
 	 */
+	template<typename C=Coefficient, EnableIf<is_subset_of_rationals<C>> = dummy>
+	carl::Sign sgn(const Coefficient& value) const {
+		return carl::filteredSign(mCoefficients, value, [this,&value](){ return carl::sgn(this->evaluate(value)); });
+	}
+	template<typename C=Coefficient, DisableIf<is_subset_of_rationals<C>> = dummy>
 	carl::Sign sgn(const Coefficient& value) const {
 		return carl::sgn(this->evaluate(value));
 	}
@@ -1245,9 +1253,9 @@ struct hash<carl::UnivariatePolynomial<Coefficient>> {
 	 */
 	std::size_t operator()(const carl::UnivariatePolynomial<Coefficient>& p) const {
 		std::size_t result = 0;
-		std::hash<Coefficient> h;
-		for(auto c: p.coefficients()) {
-			result ^= h(c);
+		carl::hash_add(result, p.mainVar());
+		for (const auto& c: p.coefficients()) {
+			carl::hash_add(result, c);
 		}
 		return result;
 	}
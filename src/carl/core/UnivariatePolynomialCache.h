@@ -0,0 +1,149 @@
+/**
+ * @file UnivariatePolynomialCache.h
+ * @ingroup unirp
+ *
+ * A bounded cache for data that is derived from univariate polynomials over and over again,
+ * for example Sturm sequences when determining signs with respect to real algebraic numbers.
+ */
+
+#pragma once
+
+#include "../config.h"
+#include "../util/hash.h"
+#include "../util/LRUCache.h"
+#include "../util/Singleton.h"
+#include "UnivariatePolynomial.h"
+#include "polynomialfunctions/RootBounds.h"
+#include "polynomialfunctions/SquareFreePart.h"
+
+#include <boost/optional.hpp>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace carl {
+
+/**
+ * Stores the derived data for a single univariate polynomial.
+ * All data is computed lazily upon the first request and kept afterwards.
+ * Objects of this class are shared between all real algebraic numbers that are defined by the same polynomial.
+ */
+template<typename Number>
+class UnivariatePolynomialInformation {
+public:
+	using Polynomial = UnivariatePolynomial<Number>;
+	using SturmSequence = std::list<Polynomial>;
+private:
+	Polynomial mPolynomial;
+	mutable boost::optional<Polynomial> mDerivative;
+	mutable boost::optional<SturmSequence> mSturmSequence;
+	mutable boost::optional<Polynomial> mSquareFreePart;
+	mutable boost::optional<Number> mCauchyBound;
+	/// Sturm sequences of p and p' * q for other polynomials q, see sturmSequence(q).
+	mutable std::unordered_map<Polynomial, std::shared_ptr<const SturmSequence>> mQuerySequences;
+	/// Maximum number of sequences stored in mQuerySequences.
+	std::size_t mMaxQuerySequences;
+	mutable std::recursive_mutex mMutex;
+
+	#ifdef THREAD_SAFE
+	#define UNIPOLY_INFO_LOCK_GUARD std::lock_guard<std::recursive_mutex> lock( mMutex );
+	#else
+	#define UNIPOLY_INFO_LOCK_GUARD
+	#endif
+public:
+	explicit UnivariatePolynomialInformation(const Polynomial& p, std::size_t maxQuerySequences = 64):
+		mPolynomial(p),
+		mMaxQuerySequences(maxQuerySequences)
+	{}
+
+	const Polynomial& polynomial() const {
+		return mPolynomial;
+	}
+	const Polynomial& derivative() const {
+		UNIPOLY_INFO_LOCK_GUARD
+		if (!mDerivative) mDerivative = mPolynomial.derivative();
+		return *mDerivative;
+	}
+	/// Returns the standard Sturm sequence of p.
+	const SturmSequence& sturmSequence() const {
+		UNIPOLY_INFO_LOCK_GUARD
+		if (!mSturmSequence) mSturmSequence = mPolynomial.standardSturmSequence(derivative());
+		return *mSturmSequence;
+	}
+	/// Stores an already computed standard Sturm sequence of p.
+	void setSturmSequence(const SturmSequence& seq) {
+		UNIPOLY_INFO_LOCK_GUARD
+		if (!mSturmSequence) mSturmSequence = seq;
+	}
+	/**
+	 * Returns the Sturm sequence of p and p' * q, as used to determine the sign of q at a root of p.
+	 * If more than the maximum number of sequences are stored, the stored sequences are discarded.
+	 */
+	std::shared_ptr<const SturmSequence> sturmSequence(const Polynomial& q) const {
+		UNIPOLY_INFO_LOCK_GUARD
+		auto it = mQuerySequences.find(q);
+		if (it != mQuerySequences.end()) return it->second;
+		if (mQuerySequences.size() >= mMaxQuerySequences) mQuerySequences.clear();
+		auto seq = std::make_shared<const SturmSequence>(mPolynomial.standardSturmSequence(derivative() * q));
+		mQuerySequences.emplace(q, seq);
+		return seq;
+	}
+	const Polynomial& squareFreePart() const {
+		UNIPOLY_INFO_LOCK_GUARD
+		if (!mSquareFreePart) mSquareFreePart = carl::squareFreePart(mPolynomial);
+		return *mSquareFreePart;
+	}
+	const Number& cauchyBound() const {
+		UNIPOLY_INFO_LOCK_GUARD
+		if (!mCauchyBound) mCauchyBound = carl::cauchyBound(mPolynomial);
+		return *mCauchyBound;
+	}
+};
+
+/**
+ * A bounded cache that maps univariate polynomials to their UnivariatePolynomialInformation.
+ * If the cache is full, the least recently used entry is dropped from the cache.
+ * Entries that are dropped stay valid as long as someone holds a reference to them.
+ */
+template<typename Number>
+class UnivariatePolynomialCache: public Singleton<UnivariatePolynomialCache<Number>> {
+	friend Singleton<UnivariatePolynomialCache<Number>>;
+public:
+	using Polynomial = UnivariatePolynomial<Number>;
+	using Information = UnivariatePolynomialInformation<Number>;
+	using InformationPtr = std::shared_ptr<Information>;
+private:
+	LRUCache<Polynomial, InformationPtr> mCache;
+public:
+	explicit UnivariatePolynomialCache(std::size_t maxSize = 1024):
+		mCache(maxSize)
+	{}
+
+	/**
+	 * Returns the information for the given polynomial.
+	 * If the polynomial is not cached yet, a new entry is created.
+	 */
+	InformationPtr get(const Polynomial& p) {
+		return mCache.get(p, [](const Polynomial& q){ return std::make_shared<Information>(q); });
+	}
+
+	void setMaxSize(std::size_t maxSize) {
+		mCache.setMaxSize(maxSize);
+	}
+	std::size_t size() const {
+		return mCache.size();
+	}
+	std::size_t hits() const {
+		return mCache.hits();
+	}
+	std::size_t misses() const {
+		return mCache.misses();
+	}
+	void clear() {
+		mCache.clear();
+	}
+};
+
+}
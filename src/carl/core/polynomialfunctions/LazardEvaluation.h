@@ -4,12 +4,60 @@
 #include "../../formula/model/evaluation/ModelEvaluation.h"
 
 #ifdef USE_COCOA
-
 #include <CoCoA/library.H>
+#endif
+
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace carl {
 namespace detail_lazard {
-	
+	/**
+	 * Describes how a single level of the extension tower reduces polynomials.
+	 * Either the variable is substituted by a term over the previous levels,
+	 * or the reductor is the minimal polynomial of a field extension and polynomials are reduced modulo the reductor.
+	 */
+	template<typename Poly>
+	struct LevelReduction {
+		Variable variable = Variable::NO_VARIABLE;
+		/// Whether variable is substituted by reductor or the reductor defines a field extension.
+		bool substitute = true;
+		Poly reductor;
+
+		static LevelReduction substitution(Variable v, const Poly& term) {
+			return LevelReduction{ v, true, term };
+		}
+		static LevelReduction extension(Variable v, const Poly& minimalPolynomial) {
+			return LevelReduction{ v, false, minimalPolynomial };
+		}
+
+		/// Reduces p, where factors that vanish on this level are divided out.
+		Poly apply(Poly p) const {
+			Poly newPoly;
+			if (substitute) {
+				CARL_LOG_DEBUG("carl.lazard", "Substituting " << variable << " by " << reductor);
+				newPoly = p.substitute(variable, reductor);
+			} else {
+				CARL_LOG_DEBUG("carl.lazard", "Obtained reductor " << reductor);
+				newPoly = p.remainder(reductor);
+			}
+			while (newPoly.isZero()) {
+				if (substitute) {
+					p = p.quotient(variable - reductor);
+					newPoly = p.substitute(variable, reductor);
+				} else {
+					p = p.quotient(reductor);
+					newPoly = p.remainder(reductor);
+				}
+				CARL_LOG_DEBUG("carl.lazard", "Reducing to " << p);
+			}
+			CARL_LOG_DEBUG("carl.lazard", "Remaining poly: " << newPoly);
+			return newPoly;
+		}
+	};
+
+#ifdef USE_COCOA
 	struct CoCoAConverter {
 		struct ConversionInfo {
 			CoCoA::SparsePolyRing mRing;
@@ -66,109 +114,185 @@ namespace detail_lazard {
 			return res;
 		}
 	};
+
+	/**
+	 * A single level of the extension tower, corresponding to one assignment of a sample point.
+	 * Levels are immutable once they are constructed and shared between all sample points with the same prefix.
+	 */
+	template<typename Rational, typename Poly>
+	struct LiftingLevel {
+		std::shared_ptr<const LiftingLevel> parent;
+		std::size_t depth = 0;
+		/// The field after this level has been added.
+		CoCoA::ring field = CoCoA::RingQQ();
+		Model<Rational, Poly> model;
+		std::map<Variable, CoCoA::RingElem> symbolsThere;
+		std::map<std::pair<long,std::size_t>, Variable> symbolsBack;
+		/// How this level reduces polynomials, which is never inherited from the parent.
+		LevelReduction<Poly> reduction;
+	};
+#endif
 }
 
+#ifdef USE_COCOA
+
+/**
+ * Stores the extension tower that is built for a sample point by LazardEvaluation.
+ *
+ * The tower only depends on the sample point, but not on the polynomial that is evaluated.
+ * A context can be extended by another assignment, which creates a new context and leaves the original one unchanged.
+ * Hence, when lifting along a CAD tree, every cell can fork the context of its parent cell and only the last level has to be constructed.
+ */
 template<typename Rational, typename Poly>
-class LazardEvaluation {
+class LazardLiftingContext {
+public:
+	using Level = detail_lazard::LiftingLevel<Rational, Poly>;
 private:
-	CoCoA::ring mQ = CoCoA::RingQQ();
-	Model<Rational, Poly> mModel;
-	
-	detail_lazard::CoCoAConverter cc;
-	std::map<Variable, CoCoA::RingElem> mSymbolsThere;
-	std::map<std::pair<long,std::size_t>, Variable> mSymbolsBack;
-	
-	Poly mLiftingPoly;
-	
-	auto buildPolyRing(Variable v, const RealAlgebraicNumber<Rational>& r) {
-		CoCoA::SparsePolyRing ring = CoCoA::NewPolyRing(mQ, {CoCoA::NewSymbol()});
-		mSymbolsThere.emplace(v, CoCoA::indets(ring)[0]);
-		mSymbolsBack.emplace(std::make_pair(CoCoA::RingID(ring), 0), v);
-		return detail_lazard::CoCoAConverter::ConversionInfo({
-			ring, mSymbolsThere, mSymbolsBack
-		});
-	}
-	
-	bool evaluatesToZero(const CoCoA::RingElem& p, const detail_lazard::CoCoAConverter::ConversionInfo& ci) const {
+	std::shared_ptr<const Level> mLevel;
+
+	explicit LazardLiftingContext(std::shared_ptr<const Level>&& level): mLevel(std::move(level)) {}
+
+	static bool evaluatesToZero(const CoCoA::RingElem& p, const detail_lazard::CoCoAConverter::ConversionInfo& ci, const Model<Rational, Poly>& model) {
+		detail_lazard::CoCoAConverter cc;
 		auto mp = cc.convertMV<Poly>(p, ci);
-		auto res = carl::model::evaluate(mp, mModel);
+		auto res = carl::model::evaluate(mp, model);
 		CARL_LOG_DEBUG("carl.lazard", "Evaluated " << p << " -> " << mp << " -> " << res);
 		assert(res.isRational() || res.isRAN());
 		if (res.isRational()) return carl::isZero(res.asRational());
 		return carl::isZero(res.asRAN());
 	}
-	
-	void extendRing(const CoCoA::ring& ring, const CoCoA::RingElem& p) {
-		mQ = CoCoA::NewQuotientRing(ring, CoCoA::ideal(p));
-	}
-	
+
 	/**
 	 * Analyzes whether we have to construct a field extension.
 	 * We may have one of two cases:
 	 * - We can eliminate v by substitution with some term
 	 * - We create a new field extension and may have to reduce the lifting polynomial
 	 *
-	 * In the first case, we return true and the term to substitute with.
-	 * In the second case, we return false and the reduction polynomial.
+	 * In the first case, the level substitutes v by the term.
+	 * In the second case, the level holds the new field and the reduction polynomial.
 	 */
-	std::pair<bool,Poly> getSubstitution(Variable v, const RealAlgebraicNumber<Rational>& r) {
+	static std::shared_ptr<const Level> buildLevel(const std::shared_ptr<const Level>& parent, Variable v, const RealAlgebraicNumber<Rational>& r) {
+		auto level = std::make_shared<Level>();
+		level->parent = parent;
+		level->depth = parent->depth + 1;
+		level->field = parent->field;
+		level->model = parent->model;
+		level->symbolsThere = parent->symbolsThere;
+		level->symbolsBack = parent->symbolsBack;
+		level->model.emplace(v, r);
 		if (r.isNumeric()) {
 			CARL_LOG_DEBUG("carl.lazard", "Is numeric: " << v << " -> " << r);
-			return std::make_pair(true, Poly(r.value()));
+			level->reduction = detail_lazard::LevelReduction<Poly>::substitution(v, Poly(r.value()));
+			return level;
 		}
-		detail_lazard::CoCoAConverter::ConversionInfo ci = buildPolyRing(v, r);
+		CoCoA::SparsePolyRing ring = CoCoA::NewPolyRing(parent->field, {CoCoA::NewSymbol()});
+		level->symbolsThere.emplace(v, CoCoA::indets(ring)[0]);
+		level->symbolsBack.emplace(std::make_pair(CoCoA::RingID(ring), 0), v);
+		detail_lazard::CoCoAConverter::ConversionInfo ci({
+			ring, level->symbolsThere, level->symbolsBack
+		});
+		detail_lazard::CoCoAConverter cc;
 		CoCoA::RingElem p = cc.convertUV(r.getIRPolynomial().replaceVariable(v), ci);
 		auto factorization = CoCoA::factor(p);
 		CARL_LOG_DEBUG("carl.lazard", "Factorization of " << p << " on " << ci.mRing << ": " << factorization);
 		for (const auto& f: factorization.myFactors()) {
-			if (evaluatesToZero(f, ci)) {
+			if (evaluatesToZero(f, ci, level->model)) {
 				CARL_LOG_DEBUG("carl.lazard", "Factor " << f << " is zero in assignment.");
 				if (CoCoA::deg(f) == 1) {
 					auto cf = -(f - CoCoA::LF(f));
-					return std::make_pair(true, cc.convertMV<Poly>(cf, ci));
+					level->reduction = detail_lazard::LevelReduction<Poly>::substitution(v, cc.convertMV<Poly>(cf, ci));
 				} else {
-					extendRing(ci.mRing, f);
-					return std::make_pair(false, cc.convertMV<Poly>(f, ci));
+					level->field = CoCoA::NewQuotientRing(ring, CoCoA::ideal(f));
+					level->reduction = detail_lazard::LevelReduction<Poly>::extension(v, cc.convertMV<Poly>(f, ci));
 				}
+				return level;
 			}
 		}
 		assert(false);
-		return std::make_pair(false, Poly());
+		return level;
 	}
-	
+
+	/// Applies a single level to p.
+	static Poly reduce(const Level& level, const Poly& p) {
+		assert(level.depth > 0);
+		return level.reduction.apply(p);
+	}
+public:
+	/// Creates an empty context, i.e. the field of rationals.
+	LazardLiftingContext(): mLevel(std::make_shared<const Level>()) {}
+
+	/**
+	 * Returns a new context where v is additionally assigned to r.
+	 * This context remains unchanged and shares all its levels with the new one.
+	 */
+	LazardLiftingContext extend(Variable v, const RealAlgebraicNumber<Rational>& r) const {
+		return LazardLiftingContext(buildLevel(mLevel, v, r));
+	}
+
+	/// Returns the number of assignments.
+	std::size_t depth() const {
+		return mLevel->depth;
+	}
+	/// Returns the context without the last assignment.
+	LazardLiftingContext parent() const {
+		assert(depth() > 0);
+		return LazardLiftingContext(std::shared_ptr<const Level>(mLevel->parent));
+	}
+	const Model<Rational, Poly>& model() const {
+		return mLevel->model;
+	}
+	/// Checks whether both contexts share the same extension tower.
+	bool operator==(const LazardLiftingContext& rhs) const {
+		return mLevel == rhs.mLevel;
+	}
+
+	/**
+	 * Reduces p with respect to the last assignment only.
+	 * This assumes that p was already reduced with respect to all previous assignments.
+	 */
+	Poly reduceLast(const Poly& p) const {
+		return reduce(*mLevel, p);
+	}
+
+	/// Reduces p with respect to all assignments, starting with the first one.
+	Poly reduce(const Poly& p) const {
+		std::vector<const Level*> levels;
+		for (const Level* l = mLevel.get(); l->depth > 0; l = l->parent.get()) {
+			levels.push_back(l);
+		}
+		Poly res = p;
+		for (auto it = levels.rbegin(); it != levels.rend(); it++) {
+			res = reduce(**it, res);
+		}
+		return res;
+	}
+};
+
+template<typename Rational, typename Poly>
+class LazardEvaluation {
+private:
+	LazardLiftingContext<Rational, Poly> mContext;
+	Poly mLiftingPoly;
 public:
 	LazardEvaluation(const Poly& p): mLiftingPoly(p) {}
+	/// Starts with the assignments of an existing context.
+	LazardEvaluation(const Poly& p, const LazardLiftingContext<Rational, Poly>& context):
+		mContext(context),
+		mLiftingPoly(context.reduce(p))
+	{}
 	
 	void substitute(Variable v, const RealAlgebraicNumber<Rational>& r) {
-		mModel.emplace(v, r);
-		auto red = getSubstitution(v, r);
-		Poly newPoly;
-		if (red.first) {
-			CARL_LOG_DEBUG("carl.lazard", "Substituting " << v << " by " << red.second);
-			newPoly = mLiftingPoly.substitute(v, red.second);
-		} else {
-			CARL_LOG_DEBUG("carl.lazard", "Obtained reductor " << red.second);
-			newPoly = mLiftingPoly.remainder(red.second);
-		}
-		while (newPoly.isZero()) {
-			if (red.first) {
-				mLiftingPoly = mLiftingPoly.quotient(v - red.second);
-				newPoly = mLiftingPoly.substitute(v, red.second);
-			} else {
-				mLiftingPoly = mLiftingPoly.quotient(red.second);
-				newPoly = mLiftingPoly.remainder(red.second);
-			}
-			CARL_LOG_DEBUG("carl.lazard", "Reducing to " << mLiftingPoly);
-		}
-		mLiftingPoly = newPoly;
-		CARL_LOG_DEBUG("carl.lazard", "Remaining poly: " << mLiftingPoly);
+		mContext = mContext.extend(v, r);
+		mLiftingPoly = mContext.reduceLast(mLiftingPoly);
 	}
 	
 	const auto& getLiftingPoly() const {
 		return mLiftingPoly;
 	}
+	const auto& getContext() const {
+		return mContext;
+	}
 };
+#endif
 
 }
-
-#endif
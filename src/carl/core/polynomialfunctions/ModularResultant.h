@@ -0,0 +1,370 @@
+/**
+ * @file ModularResultant.h
+ *
+ * Computes resultants of univariate polynomials with multivariate rational coefficients by modular methods:
+ * The polynomials are reduced modulo several word-sized primes, the resultants modulo each prime are obtained
+ * by evaluation and dense interpolation of all coefficient variables, and the integer result is lifted by
+ * chinese remaindering. The number of primes is determined by an a priori bound on the coefficients of the
+ * resultant, hence the result is always exact.
+ */
+
+#pragma once
+
+#include "../../config.h"
+#include "../../numbers/numbers.h"
+#include "../../util/SFINAE.h"
+#include "../logging.h"
+#include "../MonomialPool.h"
+#include "../Term.h"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace carl {
+
+template<typename Coeff>
+class UnivariatePolynomial;
+template<typename Coeff, typename Ordering, typename Policies>
+class MultivariatePolynomial;
+
+namespace modular_resultant {
+
+	/// Residues modulo a prime below 2^31, such that products fit into 64 bits.
+	using ModInt = std::uint64_t;
+	/// Exponent vector of the coefficient variables.
+	using Exponents = std::vector<std::size_t>;
+	/// Sparse polynomial in the coefficient variables over Z_p.
+	using ModPolynomial = std::map<Exponents, ModInt>;
+	/// Polynomial in the main variable with ModPolynomial coefficients, indexed by degree.
+	using ModUnivariatePolynomial = std::vector<ModPolynomial>;
+
+	inline ModInt mulmod(ModInt a, ModInt b, ModInt p) {
+		return (a * b) % p;
+	}
+	inline ModInt powmod(ModInt a, std::size_t e, ModInt p) {
+		ModInt res = 1;
+		while (e > 0) {
+			if (e & 1) res = mulmod(res, a, p);
+			a = mulmod(a, a, p);
+			e >>= 1;
+		}
+		return res;
+	}
+	inline ModInt invmod(ModInt a, ModInt p) {
+		assert(a % p != 0);
+		return powmod(a, p - 2, p);
+	}
+
+	/**
+	 * Returns the i'th prime above 2^30.
+	 * The primes are computed on demand and stored for later calls.
+	 */
+	inline ModInt prime(std::size_t i) {
+		static std::vector<ModInt> primes;
+#ifdef THREAD_SAFE
+		static std::mutex mutex;
+		std::lock_guard<std::mutex> guard(mutex);
+#endif
+		while (primes.size() <= i) {
+			mpz_class cur(primes.empty() ? (ModInt(1) << 30) : primes.back());
+			mpz_nextprime(cur.get_mpz_t(), cur.get_mpz_t());
+			assert(cur < mpz_class(ModInt(1) << 31));
+			primes.push_back(mpz_get_ui(cur.get_mpz_t()));
+		}
+		return primes[i];
+	}
+
+	/**
+	 * Computes the resultant of two dense univariate polynomials over Z_p with the euclidean algorithm.
+	 * Both polynomials are expected to have a nonzero leading coefficient.
+	 */
+	inline ModInt univariateResultant(std::vector<ModInt> a, std::vector<ModInt> b, ModInt p) {
+		assert(!a.empty() && a.back() != 0);
+		assert(!b.empty() && b.back() != 0);
+		ModInt res = 1;
+		while (true) {
+			std::size_t n = a.size() - 1;
+			std::size_t m = b.size() - 1;
+			if (m == 0) return mulmod(res, powmod(b.back(), n, p), p);
+			// a = a mod b
+			ModInt lcinv = invmod(b.back(), p);
+			for (std::size_t i = a.size(); i-- > m; ) {
+				if (a[i] == 0) continue;
+				ModInt factor = mulmod(a[i], lcinv, p);
+				for (std::size_t j = 0; j <= m; j++) {
+					a[i - m + j] = (a[i - m + j] + p - mulmod(factor, b[j], p)) % p;
+				}
+			}
+			a.resize(m);
+			while (!a.empty() && a.back() == 0) a.pop_back();
+			if (a.empty()) return 0;
+			std::size_t k = a.size() - 1;
+			if ((n % 2 == 1) && (m % 2 == 1)) res = (p - res) % p;
+			res = mulmod(res, powmod(b.back(), n - k, p), p);
+			std::swap(a, b);
+		}
+	}
+
+	/// Substitutes the last coefficient variable by the given value.
+	inline ModUnivariatePolynomial substituteLast(const ModUnivariatePolynomial& poly, ModInt value, ModInt p) {
+		ModUnivariatePolynomial res(poly.size());
+		for (std::size_t i = 0; i < poly.size(); i++) {
+			for (const auto& term: poly[i]) {
+				Exponents e(term.first.begin(), std::prev(term.first.end()));
+				ModInt& c = res[i][e];
+				c = (c + mulmod(term.second, powmod(value, term.first.back(), p), p)) % p;
+			}
+			for (auto it = res[i].begin(); it != res[i].end(); ) {
+				if (it->second == 0) it = res[i].erase(it);
+				else it++;
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Interpolates the values given for a number of points coefficient-wise in a new last variable.
+	 * Uses Newton interpolation.
+	 */
+	inline ModPolynomial interpolate(const std::vector<ModInt>& points, const std::vector<ModPolynomial>& values, ModInt p) {
+		assert(points.size() == values.size());
+		std::set<Exponents> monomials;
+		for (const auto& v: values) {
+			for (const auto& t: v) monomials.insert(t.first);
+		}
+		ModPolynomial res;
+		std::size_t n = points.size();
+		for (const auto& m: monomials) {
+			// Divided differences
+			std::vector<ModInt> c(n);
+			for (std::size_t i = 0; i < n; i++) {
+				auto it = values[i].find(m);
+				c[i] = (it == values[i].end()) ? 0 : it->second;
+			}
+			for (std::size_t j = 1; j < n; j++) {
+				for (std::size_t i = n - 1; i >= j; i--) {
+					ModInt num = (c[i] + p - c[i-1]) % p;
+					ModInt den = (points[i] + p - points[i-j]) % p;
+					c[i] = mulmod(num, invmod(den, p), p);
+				}
+			}
+			// Convert from Newton basis to monomial basis
+			std::vector<ModInt> poly(1, c[n-1]);
+			for (std::size_t i = n - 1; i-- > 0; ) {
+				// poly = poly * (y - points[i]) + c[i]
+				poly.push_back(0);
+				for (std::size_t k = poly.size() - 1; k > 0; k--) {
+					poly[k] = (poly[k-1] + p - mulmod(poly[k], points[i], p)) % p;
+				}
+				poly[0] = (p - mulmod(poly[0], points[i], p)) % p;
+				poly[0] = (poly[0] + c[i]) % p;
+			}
+			for (std::size_t k = 0; k < poly.size(); k++) {
+				if (poly[k] == 0) continue;
+				Exponents e(m);
+				e.push_back(k);
+				res.emplace(std::move(e), poly[k]);
+			}
+		}
+		return res;
+	}
+
+	/**
+	 * Computes the resultant of two polynomials whose coefficients are polynomials in the given number of variables.
+	 * The leading coefficients of both polynomials must not vanish.
+	 * @param a First polynomial.
+	 * @param b Second polynomial.
+	 * @param level Number of coefficient variables.
+	 * @param degreeBounds Bounds on the degree of the resultant in every coefficient variable.
+	 * @param p Prime.
+	 */
+	inline ModPolynomial resultant(const ModUnivariatePolynomial& a, const ModUnivariatePolynomial& b, std::size_t level, const std::vector<std::size_t>& degreeBounds, ModInt p) {
+		if (level == 0) {
+			std::vector<ModInt> da(a.size());
+			std::vector<ModInt> db(b.size());
+			for (std::size_t i = 0; i < a.size(); i++) da[i] = a[i].empty() ? 0 : a[i].begin()->second;
+			for (std::size_t i = 0; i < b.size(); i++) db[i] = b[i].empty() ? 0 : b[i].begin()->second;
+			ModInt r = univariateResultant(std::move(da), std::move(db), p);
+			if (r == 0) return ModPolynomial();
+			return ModPolynomial({{Exponents(), r}});
+		}
+		std::vector<ModInt> points;
+		std::vector<ModPolynomial> values;
+		for (ModInt value = 0; points.size() <= degreeBounds[level - 1]; value++) {
+			assert(value < p);
+			auto sa = substituteLast(a, value, p);
+			if (sa.back().empty()) continue;
+			auto sb = substituteLast(b, value, p);
+			if (sb.back().empty()) continue;
+			points.push_back(value);
+			values.emplace_back(resultant(sa, sb, level - 1, degreeBounds, p));
+		}
+		return interpolate(points, values, p);
+	}
+
+	/// Maps an integer to its residue in [0, p).
+	template<typename Integer>
+	ModInt residue(const Integer& n, ModInt p) {
+		Integer r = carl::mod(n, Integer(p));
+		if (r < 0) r += Integer(p);
+		return carl::toInt<carl::uint>(r);
+	}
+
+	/**
+	 * A polynomial in the main variable with integral coefficients in a fixed list of coefficient variables.
+	 */
+	template<typename Integer>
+	struct IntegralPolynomial {
+		std::vector<std::map<Exponents, Integer>> coefficients;
+
+		ModUnivariatePolynomial reduce(ModInt p) const {
+			ModUnivariatePolynomial res(coefficients.size());
+			for (std::size_t i = 0; i < coefficients.size(); i++) {
+				for (const auto& t: coefficients[i]) {
+					ModInt r = residue(t.second, p);
+					if (r != 0) res[i].emplace(t.first, r);
+				}
+			}
+			return res;
+		}
+		Integer oneNorm() const {
+			Integer res = 0;
+			for (const auto& c: coefficients) {
+				for (const auto& t: c) res += carl::abs(t.second);
+			}
+			return res;
+		}
+		std::size_t degree(std::size_t variable) const {
+			std::size_t res = 0;
+			for (const auto& c: coefficients) {
+				for (const auto& t: c) res = std::max(res, t.first[variable]);
+			}
+			return res;
+		}
+	};
+
+	/**
+	 * Converts a polynomial to an IntegralPolynomial by multiplication with the common denominator of all coefficients.
+	 * @return The integral polynomial and the factor it was multiplied with.
+	 */
+	template<typename C, typename O, typename P>
+	std::pair<IntegralPolynomial<typename IntegralType<C>::type>, typename IntegralType<C>::type> toIntegral(const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& poly, const std::vector<Variable>& vars) {
+		using Integer = typename IntegralType<C>::type;
+		Integer denom = 1;
+		for (const auto& c: poly.coefficients()) {
+			denom = carl::lcm(denom, c.mainDenom());
+		}
+		IntegralPolynomial<Integer> res;
+		res.coefficients.resize(poly.coefficients().size());
+		for (std::size_t i = 0; i < poly.coefficients().size(); i++) {
+			for (const auto& t: poly.coefficients()[i]) {
+				Exponents e(vars.size(), 0);
+				if (t.monomial()) {
+					for (const auto& ve: *t.monomial()) {
+						auto it = std::lower_bound(vars.begin(), vars.end(), ve.first);
+						assert(it != vars.end() && *it == ve.first);
+						e[std::size_t(std::distance(vars.begin(), it))] = ve.second;
+					}
+				}
+				res.coefficients[i].emplace(std::move(e), carl::getNum(C(t.coeff() * denom)));
+			}
+		}
+		return std::make_pair(res, denom);
+	}
+}
+
+/**
+ * Fallback for coefficient types that are not supported by the modular resultant computation.
+ */
+template<typename Coeff>
+boost::optional<UnivariatePolynomial<Coeff>> modularResultant(const UnivariatePolynomial<Coeff>&, const UnivariatePolynomial<Coeff>&) {
+	return boost::none;
+}
+
+/**
+ * Computes the resultant of two univariate polynomials with multivariate rational coefficients using a modular algorithm.
+ * Both polynomials are expected to have at least degree one in their main variable.
+ * @param p First polynomial.
+ * @param q Second polynomial.
+ * @return Resultant of p and q.
+ */
+template<typename C, typename O, typename P, EnableIf<is_subset_of_rationals<C>> = dummy>
+boost::optional<UnivariatePolynomial<MultivariatePolynomial<C,O,P>>> modularResultant(
+	const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& p,
+	const UnivariatePolynomial<MultivariatePolynomial<C,O,P>>& q
+) {
+	using namespace modular_resultant;
+	using Integer = typename IntegralType<C>::type;
+	using Coeff = MultivariatePolynomial<C,O,P>;
+	assert(p.mainVar() == q.mainVar());
+	assert(p.degree() > 0 && q.degree() > 0);
+
+	std::set<Variable> varset;
+	for (const auto& c: p.coefficients()) c.gatherVariables(varset);
+	for (const auto& c: q.coefficients()) c.gatherVariables(varset);
+	std::vector<Variable> vars(varset.begin(), varset.end());
+
+	auto ip = toIntegral(p, vars);
+	auto iq = toIntegral(q, vars);
+	std::size_t n = p.degree();
+	std::size_t m = q.degree();
+
+	std::vector<std::size_t> degreeBounds;
+	for (std::size_t i = 0; i < vars.size(); i++) {
+		degreeBounds.push_back(n * iq.first.degree(i) + m * ip.first.degree(i));
+	}
+	// Every coefficient of the determinant of the Sylvester matrix is bounded by the product of the row norms.
+	Integer bound = 2 * carl::pow(ip.first.oneNorm(), m) * carl::pow(iq.first.oneNorm(), n);
+
+	std::map<Exponents, Integer> result;
+	Integer modulus = 1;
+	for (std::size_t primeID = 0; modulus <= bound; primeID++) {
+		ModInt prime = modular_resultant::prime(primeID);
+		auto rp = ip.first.reduce(prime);
+		auto rq = iq.first.reduce(prime);
+		if (rp.back().empty() || rq.back().empty()) {
+			CARL_LOG_DEBUG("carl.core.resultant", "Skipping unlucky prime " << prime);
+			continue;
+		}
+		auto r = modular_resultant::resultant(rp, rq, vars.size(), degreeBounds, prime);
+		// Chinese remaindering: result = result + modulus * ((r - result) / modulus mod prime)
+		ModInt inv = invmod(residue(modulus, prime), prime);
+		std::set<Exponents> monomials;
+		for (const auto& t: result) monomials.insert(t.first);
+		for (const auto& t: r) monomials.insert(t.first);
+		for (const auto& e: monomials) {
+			Integer& cur = result[e];
+			auto it = r.find(e);
+			ModInt target = (it == r.end()) ? 0 : it->second;
+			ModInt diff = (target + prime - residue(cur, prime)) % prime;
+			cur += modulus * Integer(mulmod(diff, inv, prime));
+		}
+		modulus *= Integer(prime);
+	}
+
+	Coeff res;
+	C factor = carl::pow(C(ip.second), m) * carl::pow(C(iq.second), n);
+	Integer half = modulus / 2;
+	for (const auto& t: result) {
+		Integer c = t.second;
+		if (c > half) c -= modulus;
+		if (carl::isZero(c)) continue;
+		std::vector<std::pair<Variable, exponent>> monomial;
+		for (std::size_t i = 0; i < vars.size(); i++) {
+			if (t.first[i] > 0) monomial.emplace_back(vars[i], exponent(t.first[i]));
+		}
+		if (monomial.empty()) {
+			res += Coeff(C(C(c) / factor));
+		} else {
+			res += Term<C>(C(C(c) / factor), createMonomial(std::move(monomial)));
+		}
+	}
+	return UnivariatePolynomial<Coeff>(p.mainVar(), res);
+}
+
+}
@@ -4,8 +4,12 @@
 #include <vector>
 
 namespace carl {
+/**
+ * Strategies for the computation of subresultants and resultants.
+ * Modular only affects resultant() and discriminant() for polynomials with multivariate rational coefficients and falls back to Default otherwise.
+ */
 enum class SubresultantStrategy {
-	Generic, Lazard, Ducos, Default = Lazard
+	Generic, Lazard, Ducos, Modular, Default = Lazard
 };
 
 template<typename Coeff>
@@ -22,6 +26,7 @@ UnivariatePolynomial<Coeff> discriminant(const UnivariatePolynomial<Coeff>&, Sub
 }
 
 #include "../UnivariatePolynomial.h"
+#include "ModularResultant.h"
 
 namespace carl {
 
@@ -45,6 +50,8 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 	 */
 	assert(pol1.mainVar() == pol2.mainVar());
 	CARL_LOG_TRACE("carl.core.resultant", "subresultants(" << pol1 << ", " << pol2 << ")");
+	// The modular strategy only computes the resultant itself.
+	if (strategy == SubresultantStrategy::Modular) strategy = SubresultantStrategy::Default;
 	std::list<UnivariatePolynomial<Coeff>> subresultants;
 	Variable variable = pol1.mainVar();
 	
@@ -136,6 +143,7 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 					break;
 				}
 				case SubresultantStrategy::Ducos:
+				case SubresultantStrategy::Modular: // mapped to Default above
 				case SubresultantStrategy::Lazard: {
 					CARL_LOG_TRACE("carl.core.resultant", "Part 2: Ducos/Lazard strategy");
 					// "dichotomous Lazard": efficient exponentiation
@@ -193,6 +201,7 @@ std::list<UnivariatePolynomial<Coeff>> subresultants(
 		switch (strategy) {
 			// Compared to [Duc98], here S_{d-1} is b and S_d is a, S_e is c, and s_d is subresLcoeff.
 			case SubresultantStrategy::Generic:
+			case SubresultantStrategy::Modular: // mapped to Default above
 			case SubresultantStrategy::Lazard: {
 				CARL_LOG_TRACE("carl.core.resultant", "Part 3: Generic/Lazard strategy");
 				if (p.isZero()) return subresultants;
@@ -276,6 +285,14 @@ UnivariatePolynomial<Coeff> resultant(
 ) {
 	assert(p.mainVar() == q.mainVar());
 	if (p.isZero() || q.isZero()) return UnivariatePolynomial<Coeff>(p.mainVar());
+	if (strategy == SubresultantStrategy::Modular && !p.isConstant() && !q.isConstant()) {
+		// Same argument order as subresultants() to obtain the same sign.
+		auto res = (p.degree() < q.degree()) ? modularResultant(q.normalized(), p.normalized()) : modularResultant(p.normalized(), q.normalized());
+		if (res) {
+			CARL_LOG_TRACE("carl.core.resultant", "modular resultant(" << p << ", " << q << ") = " << *res);
+			return *res;
+		}
+	}
 	UnivariatePolynomial<Coeff> resultant = subresultants(p.normalized(), q.normalized(), strategy).front();
 	CARL_LOG_TRACE("carl.core.resultant", "resultant(" << p << ", " << q << ") = " << resultant);
 	if (resultant.isConstant()) {
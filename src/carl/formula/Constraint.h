@@ -14,6 +14,7 @@
 
 #include "../config.h"
 #include "../core/Definiteness.h"
+#include "../core/PolynomialPool.h"
 #include "../core/Relation.h"
 #include "../core/VariableInformation.h"
 #include "../core/VariablesInformation.h"
@@ -130,6 +131,10 @@ namespace carl
             mutable std::mutex mVarInfoMapMutex;
             /// Mutex for access to the factorization.
             mutable std::mutex mFactorizationMutex;
+            /// The polynomial of this constraint in the polynomial pool, only created on demand.
+            mutable PooledPolynomial<Pol> mPooledLhs;
+            /// Mutex for access to the pooled polynomial.
+            mutable std::mutex mPooledLhsMutex;
 
             /**
              * Default constructor. (0=0)
@@ -352,16 +357,33 @@ namespace carl
             
             explicit Constraint( const ConstraintContent<Pol>* _content );
             
+            /**
+             * Checks whether this constraint is consistent with the given solution space of its left-hand side.
+             * @param _solutionSpace The evaluation of the left-hand side on the interval domains of the variables.
+             * @return 1, 0 or 2, as in consistentWith().
+             */
+            unsigned consistentWithSolutionSpace( const Interval<double>& _solutionSpace ) const;
+            
+            /**
+             * Checks whether this constraint is consistent with the given solution space of its left-hand side.
+             * @param _solutionSpace The evaluation of the left-hand side on the interval domains of the variables.
+             * @param _stricterRelation The implied stricter relation, as in consistentWith().
+             * @return 1, 0 or 2, as in consistentWith().
+             */
+            unsigned consistentWithSolutionSpace( const Interval<double>& _solutionSpace, Relation& _stricterRelation ) const;
+            
             #ifdef THREAD_SAFE
             #define VARINFOMAP_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mVarInfoMapMutex );
             #define FACTORIZATION_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mFactorizationMutex );
             #define FACTORIZATION_LOCK mpContent->mFactorizationMutex.lock();
             #define FACTORIZATION_UNLOCK mpContent->mFactorizationMutex.unlock();
+            #define POOLEDLHS_LOCK_GUARD std::lock_guard<std::mutex> lock1( mpContent->mPooledLhsMutex );
             #else
             #define VARINFOMAP_LOCK_GUARD
             #define FACTORIZATION_LOCK_GUARD
             #define FACTORIZATION_LOCK
             #define FACTORIZATION_UNLOCK
+            #define POOLEDLHS_LOCK_GUARD
             #endif
             
         public:
@@ -394,6 +416,19 @@ namespace carl
                 return mpContent->lhs();
             }
 
+            /**
+             * @return The left-hand side of this constraint as a handle to the polynomial pool.
+             *          Constraints with equal left-hand sides share the same handle, hence it can be used as a key
+             *          which is hashed and compared in constant time.
+             */
+            const PooledPolynomial<Pol>& pooledLhs() const
+            {
+                POOLEDLHS_LOCK_GUARD
+                if( !mpContent->mPooledLhs )
+                    mpContent->mPooledLhs = PooledPolynomial<Pol>( mpContent->mLhs );
+                return mpContent->mPooledLhs;
+            }
+
             /**
              * @return A container containing all variables occurring in the polynomial of this constraint.
              */
@@ -691,6 +726,23 @@ namespace carl
              *          2, if it cannot be decided whether this constraint is consistent with the given intervals.
              */
             unsigned consistentWith( const EvaluationMap<Interval<double>>& _solutionInterval, Relation& _stricterRelation ) const;
+            
+            /**
+             * Checks whether this constraint is consistent with the given assignment from 
+             * the its variables to interval domains, given as a dense box.
+             * @param _solutionInterval The interval domains of the variables.
+             * @return 1, 0 or 2, as for the overload taking an EvaluationMap.
+             */
+            unsigned consistentWith( const IntervalBox<double>& _solutionInterval ) const;
+            
+            /**
+             * Checks whether this constraint is consistent with the given assignment from 
+             * the its variables to interval domains, given as a dense box.
+             * @param _solutionInterval The interval domains of the variables.
+             * @param _stricterRelation The implied stricter relation, as for the overload taking an EvaluationMap.
+             * @return 1, 0 or 2, as for the overload taking an EvaluationMap.
+             */
+            unsigned consistentWith( const IntervalBox<double>& _solutionInterval, Relation& _stricterRelation ) const;
 
 			/**
 			 * Checks whether the given interval assignment may fulfill the constraint.
@@ -417,85 +417,103 @@ namespace carl
             }
             if( varIter != variables().end() )
                 return 2;
-            Interval<double> solutionSpace = IntervalEvaluation::evaluate( lhs(), _solutionInterval );
-            if( solutionSpace.isEmpty() )
+            return consistentWithSolutionSpace( IntervalEvaluation::evaluate( lhs(), _solutionInterval ) );
+        }
+    }
+    
+    template<typename Pol>
+    unsigned Constraint<Pol>::consistentWith( const IntervalBox<double>& _solutionInterval ) const
+    {
+        if( variables().empty() )
+            return carl::evaluate( constantPart(), relation() ) ? 1 : 0;
+        for( const auto& var : variables() )
+        {
+            if( !_solutionInterval.has( var ) )
                 return 2;
-            switch( relation() )
+        }
+        return consistentWithSolutionSpace( IntervalEvaluation::evaluate( lhs(), _solutionInterval ) );
+    }
+    
+    template<typename Pol>
+    unsigned Constraint<Pol>::consistentWithSolutionSpace( const Interval<double>& solutionSpace ) const
+    {
+        if( solutionSpace.isEmpty() )
+            return 2;
+        switch( relation() )
+        {
+            case Relation::EQ:
             {
-                case Relation::EQ:
+                if( solutionSpace.isZero() )
+                    return 1;
+                else if( !solutionSpace.contains( 0 ) )
+                    return 0;
+                break;
+            }
+            case Relation::NEQ:
+            {
+                if( !solutionSpace.contains( 0 ) )
+                    return 1;
+                break;
+            }
+            case Relation::LESS:
+            {
+                if( solutionSpace.upperBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.isZero() )
+                    if( solutionSpace.upper() < 0 )
+                        return 1;
+                    else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
                         return 1;
-                    else if( !solutionSpace.contains( 0 ) )
-                        return 0;
-                    break;
                 }
-                case Relation::NEQ:
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
+                    return 0;
+                break;
+            }
+            case Relation::GREATER:
+            {
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY )
                 {
-                    if( !solutionSpace.contains( 0 ) )
+                    if( solutionSpace.lower() > 0 )
+                        return 1;
+                    else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
                         return 1;
-                    break;
                 }
-                case Relation::LESS:
+                if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0 )
+                    return 0;
+                break;
+            }
+            case Relation::LEQ:
+            {
+                if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0)
+                    return 1;
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.upper() < 0 )
-                            return 1;
-                        else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
-                            return 1;
-                    }
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
+                    if( solutionSpace.lower() > 0 )
                         return 0;
-                    break;
-                }
-                case Relation::GREATER:
-                {
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.lower() > 0 )
-                            return 1;
-                        else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
-                            return 1;
-                    }
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0 )
+                    else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
                         return 0;
-                    break;
-                }
-                case Relation::LEQ:
-                {
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0)
-                        return 1;
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.lower() > 0 )
-                            return 0;
-                        else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
-                            return 0;
-                    }
-                    break;
-                }
-                case Relation::GEQ:
-                {
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
-                        return 1;
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.upper() < 0 )
-                            return 0;
-                        else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
-                            return 0;
-                    }
-                    break;
                 }
-                default:
+                break;
+            }
+            case Relation::GEQ:
+            {
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
+                    return 1;
+                if( solutionSpace.upperBoundType() != BoundType::INFTY )
                 {
-                    cout << "Error in isConsistent: unexpected relation symbol." << endl;
-                    return 0;
+                    if( solutionSpace.upper() < 0 )
+                        return 0;
+                    else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
+                        return 0;
                 }
+                break;
+            }
+            default:
+            {
+                cout << "Error in isConsistent: unexpected relation symbol." << endl;
+                return 0;
             }
-            return 2;
         }
+        return 2;
     }
     
     template<typename Pol>
@@ -526,117 +544,137 @@ namespace carl
             }
             if( varIter != variables().end() )
                 return 2;
-            Interval<double> solutionSpace = IntervalEvaluation::evaluate( lhs(), _solutionInterval );
-            if( solutionSpace.isEmpty() )
+            return consistentWithSolutionSpace( IntervalEvaluation::evaluate( lhs(), _solutionInterval ), _stricterRelation );
+        }
+    }
+    
+    template<typename Pol>
+    unsigned Constraint<Pol>::consistentWith( const IntervalBox<double>& _solutionInterval, Relation& _stricterRelation ) const
+    {
+        _stricterRelation = relation();
+        if( variables().empty() )
+            return carl::evaluate( constantPart(), relation() ) ? 1 : 0;
+        for( const auto& var : variables() )
+        {
+            if( !_solutionInterval.has( var ) )
                 return 2;
-            switch( relation() )
+        }
+        return consistentWithSolutionSpace( IntervalEvaluation::evaluate( lhs(), _solutionInterval ), _stricterRelation );
+    }
+    
+    template<typename Pol>
+    unsigned Constraint<Pol>::consistentWithSolutionSpace( const Interval<double>& solutionSpace, Relation& _stricterRelation ) const
+    {
+        _stricterRelation = relation();
+        if( solutionSpace.isEmpty() )
+            return 2;
+        switch( relation() )
+        {
+            case Relation::EQ:
             {
-                case Relation::EQ:
+                if( solutionSpace.isZero() )
+                    return 1;
+                else if( !solutionSpace.contains( 0 ) )
+                    return 0;
+                break;
+            }
+            case Relation::NEQ:
+            {
+                if( !solutionSpace.contains( 0 ) )
+                    return 1;
+                if( solutionSpace.upperBoundType() == BoundType::WEAK && solutionSpace.upper() == 0 )
                 {
-                    if( solutionSpace.isZero() )
-                        return 1;
-                    else if( !solutionSpace.contains( 0 ) )
-                        return 0;
-                    break;
+                    _stricterRelation = Relation::LESS;
                 }
-                case Relation::NEQ:
+                else if( solutionSpace.lowerBoundType() == BoundType::WEAK && solutionSpace.lower() == 0 )
                 {
-                    if( !solutionSpace.contains( 0 ) )
+                    _stricterRelation = Relation::GREATER;
+                }
+                break;
+            }
+            case Relation::LESS:
+            {
+                if( solutionSpace.upperBoundType() != BoundType::INFTY )
+                {
+                    if( solutionSpace.upper() < 0 )
+                        return 1;
+                    else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
                         return 1;
-                    if( solutionSpace.upperBoundType() == BoundType::WEAK && solutionSpace.upper() == 0 )
-                    {
-                        _stricterRelation = Relation::LESS;
-                    }
-                    else if( solutionSpace.lowerBoundType() == BoundType::WEAK && solutionSpace.lower() == 0 )
-                    {
-                        _stricterRelation = Relation::GREATER;
-                    }
-                    break;
                 }
-                case Relation::LESS:
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
+                    return 0;
+                break;
+            }
+            case Relation::GREATER:
+            {
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.upper() < 0 )
-                            return 1;
-                        else if( solutionSpace.upper() == 0 && solutionSpace.upperBoundType() == BoundType::STRICT )
-                            return 1;
-                    }
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY && solutionSpace.lower() >= 0 )
-                        return 0;
-                    break;
+                    if( solutionSpace.lower() > 0 )
+                        return 1;
+                    else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
+                        return 1;
                 }
-                case Relation::GREATER:
+                if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0 )
+                    return 0;
+                break;
+            }
+            case Relation::LEQ:
+            {
+                if( solutionSpace.upperBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY )
+                    if( solutionSpace.upper() <= 0)
                     {
-                        if( solutionSpace.lower() > 0 )
-                            return 1;
-                        else if( solutionSpace.lower() == 0 && solutionSpace.lowerBoundType() == BoundType::STRICT )
-                            return 1;
+                        return 1;
                     }
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY && solutionSpace.upper() <= 0 )
-                        return 0;
-                    break;
                 }
-                case Relation::LEQ:
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY )
+                    if( solutionSpace.lower() > 0 )
                     {
-                        if( solutionSpace.upper() <= 0)
-                        {
-                            return 1;
-                        }
+                        return 0;
                     }
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY )
+                    else if( solutionSpace.lower() == 0 )
                     {
-                        if( solutionSpace.lower() > 0 )
+                        if( solutionSpace.lowerBoundType() == BoundType::STRICT )
                         {
                             return 0;
                         }
-                        else if( solutionSpace.lower() == 0 )
+                        else
                         {
-                            if( solutionSpace.lowerBoundType() == BoundType::STRICT )
-                            {
-                                return 0;
-                            }
-                            else
-                            {
-                                _stricterRelation = Relation::EQ;
-                            }
+                            _stricterRelation = Relation::EQ;
                         }
                     }
-                    break;
                 }
-                case Relation::GEQ:
+                break;
+            }
+            case Relation::GEQ:
+            {
+                if( solutionSpace.lowerBoundType() != BoundType::INFTY )
                 {
-                    if( solutionSpace.lowerBoundType() != BoundType::INFTY )
-                    {
-                        if( solutionSpace.lower() >= 0 )
-                            return 1;
-                    }
-                    if( solutionSpace.upperBoundType() != BoundType::INFTY )
+                    if( solutionSpace.lower() >= 0 )
+                        return 1;
+                }
+                if( solutionSpace.upperBoundType() != BoundType::INFTY )
+                {
+                    if( solutionSpace.upper() < 0 )
+                        return 0;
+                    else if( solutionSpace.upper() == 0 )
                     {
-                        if( solutionSpace.upper() < 0 )
+                        if( solutionSpace.upperBoundType() == BoundType::STRICT )
                             return 0;
-                        else if( solutionSpace.upper() == 0 )
-                        {
-                            if( solutionSpace.upperBoundType() == BoundType::STRICT )
-                                return 0;
-                            else
-                                _stricterRelation = Relation::EQ;
-                        }
+                        else
+                            _stricterRelation = Relation::EQ;
                     }
-                    break;
-                }
-                default:
-                {
-                    cout << "Error in isConsistent: unexpected relation symbol." << endl;
-                    return 0;
                 }
+                break;
+            }
+            default:
+            {
+                cout << "Error in isConsistent: unexpected relation symbol." << endl;
+                return 0;
             }
-            return 2;
         }
+        return 2;
     }
 
 	template<typename Pol>
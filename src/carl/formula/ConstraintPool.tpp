@@ -26,6 +26,7 @@ namespace carl
     {
         VariablePool::getInstance();
 		MonomialPool::getInstance();
+		PolynomialPool<Pol>::getInstance();
         if( needs_cache<Pol>::value )
         {
             mpPolynomialCache = std::shared_ptr<typename Pol::CACHE>(new typename Pol::CACHE());
@@ -33,9 +34,9 @@ namespace carl
             setGinacConverterPolynomialCache<Pol>( mpPolynomialCache );
 #endif
         }
-		/* Make sure that the MonomialPool is created before the ConstraintPool.
-		 * Thereby, the MonomialPool gets destroyed after the ConstraintPool.
-		 * Thereby, destroying the constraints (and the Monomials contained) works correctly.
+		/* Make sure that the MonomialPool and the PolynomialPool are created before the ConstraintPool.
+		 * Thereby, they get destroyed after the ConstraintPool.
+		 * Thereby, destroying the constraints (and the Monomials and pooled polynomials contained) works correctly.
 		 */
         mConstraints.reserve( _capacity );
         mConstraints.insert( mConsistentConstraint );
@@ -241,7 +241,7 @@ public:
 	const auto& getIRSturmSequence() const {
 		assert(!isNumeric());
 		assert(isInterval());
-		return mIR->sturmSequence;
+		return mIR->sturmSequence();
 	}
 
 	RealAlgebraicNumber changeVariable(Variable v) const {
@@ -265,7 +265,7 @@ public:
 
 	Sign sgn(const Polynomial& p) const {
 		if (isNumeric()) {
-			return carl::sgn(p.evaluate(mValue));
+			return p.sgn(mValue);
 		} else if (isInterval()){
 			return mIR->sgn(p);
 		} else {
@@ -276,7 +276,10 @@ public:
 
 	bool isRootOf(const UnivariatePolynomial<Number>& p) const {
 		if (isNumeric()) return p.countRealRoots(value()) == 1;
-		else if (isInterval()) return p.countRealRoots(mIR->interval) == 1;
+		else if (isInterval()) {
+			// p is usually queried only once, hence its Sturm sequence is computed locally instead of evicting defining polynomials from the cache.
+			return p.countRealRoots(mIR->interval) == 1;
+		}
 		else if (isThom()) return this->sgn(p) == Sign::ZERO;
 		else return false;
 	}
@@ -50,11 +50,10 @@ namespace carl {
 			assert(getIRPolynomial().mainVar() == n.getIRPolynomial().mainVar());
 			auto g = UnivariatePolynomial<Number>::gcd(getIRPolynomial(), n.getIRPolynomial());
 			if (!isRootOf(g)) return false;
-			mIR->polynomial = g;
-			mIR->sturmSequence = g.standardSturmSequence();
+			mIR->setPolynomial(g);
 			if (!n.isRootOf(g)) return false;
-			n.mIR->polynomial = g;
-			n.mIR->sturmSequence = mIR->sturmSequence;
+			n.mIR->polynomial = mIR->polynomial;
+			n.mIR->information = mIR->information;
 			return equal(n);
 		}
 		return equal(n);
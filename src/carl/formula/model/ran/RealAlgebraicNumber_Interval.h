@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../../core/UnivariatePolynomial.h"
+#include "../../../core/UnivariatePolynomialCache.h"
 
 #include "../../../interval/Interval.h"
 
@@ -14,12 +15,14 @@ namespace ran {
 	template<typename Number>
 	struct IntervalContent {
 		using Polynomial = UnivariatePolynomial<Number>;
+		using Cache = UnivariatePolynomialCache<Number>;
 		
 		static const Variable auxVariable;
 		
 		Polynomial polynomial;
 		Interval<Number> interval;
-		std::list<Polynomial> sturmSequence;
+		/// Derived data of polynomial, shared with all other numbers defined by the same polynomial.
+		typename Cache::InformationPtr information;
 		std::size_t refinementCount;
 		
 		Polynomial replaceVariable(const Polynomial& p) const {
@@ -32,7 +35,7 @@ namespace ran {
 		):
 			polynomial(replaceVariable(p)),
 			interval(i),
-			sturmSequence(p.standardSturmSequence()),
+			information(Cache::getInstance().get(polynomial)),
 			refinementCount(0)
 		{}
 		
@@ -43,23 +46,41 @@ namespace ran {
 		):
 			polynomial(replaceVariable(p)),
 			interval(i),
-			sturmSequence(seq),
+			information(Cache::getInstance().get(polynomial)),
 			refinementCount(0)
-		{}
+		{
+			information->setSturmSequence(replaceVariable(seq));
+		}
+
+		std::list<Polynomial> replaceVariable(const std::list<Polynomial>& seq) const {
+			std::list<Polynomial> res;
+			for (const auto& p: seq) res.emplace_back(replaceVariable(p));
+			return res;
+		}
+		const std::list<Polynomial>& sturmSequence() const {
+			return information->sturmSequence();
+		}
+		int countRealRoots(const Interval<Number>& i) const {
+			return Polynomial::countRealRoots(sturmSequence(), i);
+		}
 		bool isIntegral() {
 			return interval.isPointInterval() && carl::isInteger(interval.lower());
 		}
 		
 		void setPolynomial(const Polynomial& p) {
 			polynomial = replaceVariable(p);
-			sturmSequence = polynomial.standardSturmSequence();
+			information = Cache::getInstance().get(polynomial);
 		}
 		
 		Sign sgn(const Polynomial& p) const {
 			Polynomial tmp = replaceVariable(p);
 			if (polynomial == tmp) return Sign::ZERO;
-			auto seq = polynomial.standardSturmSequence(polynomial.derivative() * tmp);
-			int variations = Polynomial::countRealRoots(seq, interval);
+			if (interval.isPointInterval()) return tmp.sgn(interval.lower());
+			// If p has no root within the isolating interval, its sign on the whole interval is the answer.
+			auto filtered = carl::filteredIntervalSign(tmp.coefficients(), interval.lower(), interval.upper());
+			if (filtered) return *filtered;
+			auto seq = information->sturmSequence(tmp);
+			int variations = Polynomial::countRealRoots(*seq, interval);
 			assert((variations == -1) || (variations == 0) || (variations == 1));
 			switch (variations) {
 				case -1: return Sign::NEGATIVE;
@@ -77,7 +98,7 @@ namespace ran {
 			if (polynomial.isRoot(pivot)) {
 				interval = Interval<Number>(pivot, pivot);
 			} else {
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
+				if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, pivot, BoundType::STRICT)) > 0) {
 					interval.setUpper(pivot);
 				} else {
 					interval.setLower(pivot);
@@ -99,7 +120,7 @@ namespace ran {
 					interval = Interval<Number>(n, n);
 					return true;
 				}
-				if (polynomial.countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
+				if (countRealRoots(Interval<Number>(interval.lower(), BoundType::STRICT, n, BoundType::STRICT)) > 0) {
 					interval.setUpper(n);
 				} else {
 					interval.setLower(n);
@@ -124,7 +145,7 @@ namespace ran {
 				interval.setUpper(newBound);
 			}
 			
-			while (polynomial.countRealRoots(interval) == 0) {
+			while (countRealRoots(interval) == 0) {
 				if (isLeft) {
 					Number oldBound = interval.lower();
 					newBound = Interval<Number>(n, BoundType::STRICT, oldBound, BoundType::STRICT).sample();
@@ -91,6 +91,14 @@ public:
 		return *this;
 	}
 	
+	/**
+	 * The procedure which computes the Groebner basis, for example to change its settings.
+	 */
+	Procedure<Polynomial, AddingPolynomialPolicy>& procedure()
+	{
+		return *this;
+	}
+
 	/**
 	 * Check whether a polynomial is scheduled to be added to the Groebner basis.
      * @return whether the input is empty.
@@ -242,7 +250,14 @@ public:
 			Polynomial res = reduct.fullReduce();
 			if(res.isZero())
 			{
-				result.push_back(std::pair<BitVector, BitVector>(index->getReasons(), res.getReasons()));
+				if(Polynomial::Policy::has_reasons)
+				{
+					result.push_back(std::pair<BitVector, BitVector>(index->getReasons(), res.getReasons()));
+				}
+				else
+				{
+					result.push_back(std::pair<BitVector, BitVector>());
+				}
 			}
 			else // ( !res.isZero( ) )
 			{
@@ -292,7 +307,7 @@ private:
 			Polynomial res = reduct.fullReduce();
             if(!res.isZero())
             {
-                res.normalize();
+                res = res.normalize();
                 CARL_LOG_DEBUG("carl.gb.gbproc", "GB Reduction, reduced " << mGb->getGenerator(*index) << " to " << res);
                 reduced->addGenerator(res);
             }
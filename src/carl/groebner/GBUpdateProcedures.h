@@ -27,7 +27,7 @@ public:
 		{
 			gb->clear();
 			Polynomial q(1);
-			q.setReasons(p.getReasons());
+			if(Polynomial::Policy::has_reasons) q.setReasons(p.getReasons());
 			gb->addGenerator(q);
 			return true;
 		}
@@ -63,7 +63,7 @@ public:
 		{
 			gb->clear();
 			Polynomial q(1);
-			q.setReasons(p.getReasons());
+			if(Polynomial::Policy::has_reasons) q.setReasons(p.getReasons());
 			gb->addGenerator(q);
 			return true;
 		}
@@ -74,7 +74,7 @@ public:
 #ifdef BUCHBERGER_STATISTICS
 			if(q.lterm().tdeg() != p.lterm().tdeg()) mStats->SingleTermSFP();
 #endif
-			q.setReasons(p.getReasons());
+			if(Polynomial::Policy::has_reasons) q.setReasons(p.getReasons());
 			size_t index = gb->addGenerator(q);
 			(*update)(index);
 		}
@@ -87,7 +87,7 @@ public:
 #endif
 				gb->clear();
 				Polynomial q(1);
-				q.setReasons(p.getReasons());
+				if(Polynomial::Policy::has_reasons) q.setReasons(p.getReasons());
 				gb->addGenerator(q);
 				return true;
 			}
@@ -103,7 +103,7 @@ public:
 #ifdef BUCHBERGER_STATISTICS
 					if(remainder.lterm().tdeg() != r1.lterm().tdeg()) mStats->SingleTermSFP();
 #endif
-					r1.setReasons(p.getReasons());
+					if(Polynomial::Policy::has_reasons) r1.setReasons(p.getReasons());
 					remainder.stripLT();
 					size_t index = gb->addGenerator(r1);
 					(*update)(index);
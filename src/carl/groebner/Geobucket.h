@@ -0,0 +1,233 @@
+/**
+ * @file   Geobucket.h
+ * @ingroup gb
+ */
+
+#pragma once
+
+#include "ReductorEntry.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Geobuckets as described by Yan in "The geobucket data structure for polynomials", to be used as datastructure of the Reductor.
+ *
+ * Instead of storing the multiples of polynomials lazily as the Heap does, all terms are expanded and summed up.
+ * The sum is stored in buckets of sorted terms, where bucket i holds at most 4^(i+1) terms.
+ * A polynomial is merged into the bucket matching its size and overflowing buckets are merged into the next one,
+ * hence every term takes part in a logarithmic number of merges only.
+ *
+ * The entries handed out by top() represent a single term, namely the leading term of the whole sum.
+ * Like the Heap, the geobucket takes ownership of pushed entries, and an entry which was returned by pop() is owned by the caller.
+ * The Configuration is the one of the Heap and additionally defines the polynomial type as PolynomialType.
+ * @ingroup gb
+ */
+template<class C>
+class Geobucket
+{
+public:
+	using Configuration = C;
+	using Entry = typename Configuration::Entry;
+	using EntryType = typename Configuration::EntryType;
+	using Polynomial = typename Configuration::PolynomialType;
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+	/// Terms sorted by the ordering, starting with the smallest one.
+	using Bucket = std::vector<Term<Coeff>>;
+
+	explicit Geobucket(const Configuration& configuration):
+		mConf(configuration)
+	{}
+	Geobucket(const Geobucket&) = delete;
+	Geobucket& operator=(const Geobucket&) = delete;
+	~Geobucket()
+	{
+		delete mTop;
+	}
+
+	Configuration& getConfiguration()
+	{
+		return mConf;
+	}
+	const Configuration& getConfiguration() const
+	{
+		return mConf;
+	}
+
+	/**
+	 * Adds the polynomial represented by the entry to the sum and deletes the entry.
+	 */
+	void push(Entry entry)
+	{
+		restoreTop();
+		Bucket terms;
+		terms.reserve(entry->getTail().nrTerms() + 1);
+		for(const auto& term : entry->getTail())
+		{
+			terms.push_back(entry->getMultiple() * term);
+		}
+		if(!entry->getTail().isOrdered())
+		{
+			std::sort(terms.begin(), terms.end(), [](const Term<Coeff>& a, const Term<Coeff>& b){ return Ordering::less(a, b); });
+		}
+		if(!entry->getLead().isZero())
+		{
+			assert(terms.empty() || Ordering::less(terms.back(), entry->getLead()));
+			terms.push_back(entry->getLead());
+		}
+		delete entry;
+		insert(std::move(terms));
+	}
+
+	/**
+	 * Removes the leading term of the sum.
+	 * @return An entry for the leading term, which is owned by the caller.
+	 */
+	Entry pop()
+	{
+		Entry res = top();
+		mTop = nullptr;
+		return res;
+	}
+
+	/**
+	 * @return An entry for the leading term of the sum, or nullptr if the sum is zero.
+	 */
+	Entry top() const
+	{
+		if(mTop == nullptr) findTop();
+		return mTop;
+	}
+
+	bool empty() const
+	{
+		return top() == nullptr;
+	}
+
+	/**
+	 * Should be called if the entry of the leading term has been replaced by the polynomial it represents without its leading term.
+	 */
+	void decreaseTop(Entry newEntry)
+	{
+		assert(newEntry == mTop);
+		mTop = nullptr;
+		push(newEntry);
+	}
+
+	/// Number of terms stored in the buckets, where terms with the same monomial may be counted multiple times.
+	std::size_t size() const
+	{
+		std::size_t res = (mTop == nullptr) ? 0 : 1;
+		for(const auto& bucket : mBuckets) res += bucket.size();
+		return res;
+	}
+
+private:
+	static constexpr std::size_t base = 4;
+
+	Configuration mConf;
+	mutable std::vector<Bucket> mBuckets;
+	/// The leading term, if it was already removed from the buckets.
+	mutable Entry mTop = nullptr;
+
+	/// Moves the leading term, which has been removed by top(), back to the buckets.
+	void restoreTop()
+	{
+		if(mTop == nullptr) return;
+		Bucket terms(1, mTop->getLead());
+		delete mTop;
+		mTop = nullptr;
+		insert(std::move(terms));
+	}
+
+	void insert(Bucket&& terms)
+	{
+		if(terms.empty()) return;
+		std::size_t index = 0;
+		std::size_t capacity = base;
+		while(terms.size() > capacity)
+		{
+			++index;
+			capacity *= base;
+		}
+		while(true)
+		{
+			if(mBuckets.size() <= index) mBuckets.resize(index + 1);
+			if(!mBuckets[index].empty())
+			{
+				terms = merge(std::move(mBuckets[index]), std::move(terms));
+				mBuckets[index].clear();
+			}
+			if(terms.size() <= capacity)
+			{
+				mBuckets[index] = std::move(terms);
+				return;
+			}
+			++index;
+			capacity *= base;
+		}
+	}
+
+	/// Merges two sorted buckets, adding the coefficients of equal monomials.
+	static Bucket merge(Bucket&& lhs, Bucket&& rhs)
+	{
+		Bucket res;
+		res.reserve(lhs.size() + rhs.size());
+		auto l = lhs.begin();
+		auto r = rhs.begin();
+		while(l != lhs.end() && r != rhs.end())
+		{
+			CompareResult cmp = Ordering::compare(l->monomial(), r->monomial());
+			if(cmp == CompareResult::LESS) res.push_back(std::move(*l++));
+			else if(cmp == CompareResult::GREATER) res.push_back(std::move(*r++));
+			else
+			{
+				l->coeff() += r->coeff();
+				if(!carl::isZero(l->coeff())) res.push_back(std::move(*l));
+				++l;
+				++r;
+			}
+		}
+		res.insert(res.end(), std::make_move_iterator(l), std::make_move_iterator(lhs.end()));
+		res.insert(res.end(), std::make_move_iterator(r), std::make_move_iterator(rhs.end()));
+		return res;
+	}
+
+	/// Removes the leading term from the buckets and stores it in mTop.
+	void findTop() const
+	{
+		while(true)
+		{
+			std::size_t max = mBuckets.size();
+			for(std::size_t i = 0; i < mBuckets.size(); ++i)
+			{
+				if(mBuckets[i].empty()) continue;
+				if(max == mBuckets.size() || Ordering::less(mBuckets[max].back(), mBuckets[i].back())) max = i;
+			}
+			if(max == mBuckets.size()) return;
+			Monomial::Arg monomial = mBuckets[max].back().monomial();
+			Coeff coeff(0);
+			for(auto& bucket : mBuckets)
+			{
+				if(!bucket.empty() && bucket.back().monomial() == monomial)
+				{
+					coeff += bucket.back().coeff();
+					bucket.pop_back();
+				}
+			}
+			if(!carl::isZero(coeff))
+			{
+				mTop = new EntryType(Term<Coeff>(coeff, monomial));
+				return;
+			}
+		}
+	}
+};
+
+}
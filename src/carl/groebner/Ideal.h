@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "ideal-ds/IdealDSTrie.h"
 #include "ideal-ds/IdealDSVector.h"
 #include "ideal-ds/PolynomialSorts.h"
 
@@ -84,6 +85,12 @@ public:
         return mDivisorLookup.isDividable(m);
     }
 
+    /// The datastructure used to find divisors, for example to retrieve its statistics.
+    const Datastructure<Polynomial>& divisorLookup() const
+    {
+        return mDivisorLookup;
+    }
+
 	size_t nrGenerators() const
 	{
 		return mGenerators.size();
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "Geobucket.h"
 #include "Ideal.h"
 #include "ReductorEntry.h"
 #include "../util/Heap.h"
@@ -24,6 +25,7 @@ class ReductorConfiguration
 {
 public:
 
+	using PolynomialType = Polynomial;
 	using EntryType = ReductorEntry<Polynomial>;
 	using Entry = EntryType*;
 	using CompareResult = carl::CompareResult;
@@ -64,7 +66,7 @@ public:
  * A dedicated algorithm for calculating the remainder of a polynomial modulo a set of other polynomials. 
  * @ingroup gb
  */
-template<typename InputPolynomial, typename PolynomialInIdeal, template <class> class Datastructure = carl::Heap, template <typename Polynomial> class Configuration = ReductorConfiguration>
+template<typename InputPolynomial, typename PolynomialInIdeal, template <class> class Datastructure = carl::Heap, template <typename Polynomial> class Configuration = ReductorConfiguration, template <class> class IdealDatastructure = IdealDatastructureVector>
 class Reductor
 {
 	
@@ -73,13 +75,13 @@ protected:
 	using EntryType = typename Configuration<InputPolynomial>::EntryType;
 	using Coeff = typename InputPolynomial::CoeffType;
 private:
-	const Ideal<PolynomialInIdeal>& mIdeal;
+	const Ideal<PolynomialInIdeal, IdealDatastructure>& mIdeal;
 	Datastructure<Configuration<InputPolynomial>> mDatastruct;
 	std::vector<Term<Coeff>> mRemainder;
 	bool mReductionOccured;
 	BitVector mReasons;
 public:
-	Reductor(const Ideal<PolynomialInIdeal>& ideal, const InputPolynomial& f) :
+	Reductor(const Ideal<PolynomialInIdeal, IdealDatastructure>& ideal, const InputPolynomial& f) :
 	mIdeal(ideal), mDatastruct(Configuration<InputPolynomial>()), mReductionOccured(false)
 	{
 		insert(f, Term<Coeff>(Coeff(1)));
@@ -90,7 +92,7 @@ public:
 				
 	}
 
-	Reductor(const Ideal<PolynomialInIdeal>& ideal, const Term<Coeff>& f) :
+	Reductor(const Ideal<PolynomialInIdeal, IdealDatastructure>& ideal, const Term<Coeff>& f) :
 	mIdeal(ideal), mDatastruct(Configuration<InputPolynomial>())
 	{
 		insert(f);
@@ -45,6 +45,22 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic3()
 }
 
 
+template<typename C, typename O, typename P>
+std::vector<MultivariatePolynomial<C, O, P>> cyclic4()
+{
+	carl::StringParser sp;
+	sp.setVariables({"w", "x", "y", "z"});
+	std::vector<MultivariatePolynomial<C, O, P>> res;
+	// w + x + y + z
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("w + x + y + z"));
+	// w*x + x*y + y*z + z*w
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("w*x + x*y + y*z + z*w"));
+	// w*x*y + x*y*z + y*z*w + z*w*x
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("w*x*y + x*y*z + y*z*w + z*w*x"));
+	// w*x*y*z - 1
+	res.push_back(sp.parseMultivariatePolynomial<C, O, P>("w*x*y*z + -1"));
+	return res;
+}
 
 #define run_cyclic_case(INDEX)	case INDEX: return cyclic##INDEX<C, O, P>()
 	
@@ -55,13 +71,14 @@ std::vector<MultivariatePolynomial<C, O, P>> cyclic(unsigned index)
 	{
 		run_cyclic_case(2);
 		run_cyclic_case(3);
+		run_cyclic_case(4);
 		//run_katsura_case(4);
 		//run_katsura_case(5);
 		//run_katsura_case(6);
 		//run_katsura_case(4);
 		default:
 			assert(index > 1);
-			assert(index < 4);
+			assert(index < 5);
 	}
 	return std::vector<MultivariatePolynomial<C, O, P>>();
 }
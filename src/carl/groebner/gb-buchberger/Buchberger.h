@@ -36,6 +36,7 @@
 #include "../Reductor.h"
 #include "CriticalPairs.h"
 
+#include <algorithm>
 #include <list>
 #include <unordered_map>
 
@@ -76,6 +77,10 @@ struct DefaultBuchbergerSettings
 /**
  * Gebauer and Moeller style implementation of the Buchberger algorithm. For more information about this Algorithm.
  * More information can be found in the Bachelor Thesis On Groebner Bases in SMT-Compliant Decision Procedures. 
+ *
+ * If multiple threads are set, all critical pairs whose lcm has the minimal degree are reduced concurrently
+ * against a snapshot of the current basis. The remainders are then reduced once more against the basis and added
+ * in the order of the pairs, such that the result does not depend on the number of threads.
  * @ingroup gb
  */
 template<typename Polynomial, template<typename> class AddingPolicy>
@@ -90,6 +95,9 @@ protected:
 #ifdef BUCHBERGER_STATISTICS
 	BuchbergerStats* mStats;
 #endif
+private:
+	/// Number of threads used to reduce S-polynomials, only used with THREAD_SAFE.
+	std::size_t mThreads = 1;
 
 
 public:
@@ -108,7 +116,8 @@ public:
 		pGb(new Ideal<Polynomial>(*rhs.pGb)),
 		mGbElementsIndices(rhs.mGbElementsIndices),
 		pCritPairs(new CritPairs(*rhs.pCritPairs)),
-		mUpdateCallBack(this)
+		mUpdateCallBack(this),
+		mThreads(rhs.mThreads)
 	{
 	}
 	
@@ -122,6 +131,19 @@ public:
 		pCritPairs = criticalPairs;
 	}
 
+	/**
+	 * Sets the number of threads used by calculate() to reduce S-polynomials.
+	 * Without THREAD_SAFE, the S-polynomials are always reduced sequentially.
+	 */
+	void setThreads(std::size_t threads)
+	{
+		mThreads = std::max(threads, std::size_t(1));
+	}
+	std::size_t threads() const
+	{
+		return mThreads;
+	}
+
 	//std::list<std::pair<BitVector, BitVector> > reduceInput();
 
 	void update(size_t index);
@@ -132,6 +154,11 @@ protected:
 		 CARL_LOG_DEBUG("carl.gb.buchberger", "Add to gb: " << newPol);
 		 return AddingPolicy<Polynomial>::addToGb( newPol, pGb, &mUpdateCallBack);
 	}
+	/**
+	 * Removes all critical pairs with an lcm of minimal degree, reduces their S-polynomials concurrently and adds the remainders to the basis.
+	 * @return true, if a constant polynomial was added.
+	 */
+	bool reduceBatch();
 	void removeBuchbergerTriples(std::unordered_map<size_t, SPolPair>& spairs, std::vector<size_t>& primelist);
 
 	void reduce();
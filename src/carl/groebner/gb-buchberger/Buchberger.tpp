@@ -28,6 +28,9 @@
 #include "Buchberger.h"
 
 #include "../../core/polynomialfunctions/SPolynomial.h"
+
+#include <atomic>
+#include <thread>
 //
 //
 namespace carl
@@ -48,7 +51,7 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	bool foundGB = false;
 	for(const Polynomial& newPol : scheduledForAdding)
 	{
-		if(addToGb(newPol))
+		if(addToGb(newPol.normalize()))
 		{
 			CARL_LOG_INFO("carl.gb.buchberger", "Added a constant polynomial.");
 			foundGB = true;
@@ -62,6 +65,13 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	{
 		while(!pCritPairs->empty())
 		{
+#ifdef THREAD_SAFE
+			if(mThreads > 1)
+			{
+				if(reduceBatch()) break;
+				continue;
+			}
+#endif
 			// Takes the next pair scheduled
 			SPolPair critPair = pCritPairs->pop();
             assert( critPair.mP1 < pGb->getGenerators().size() );
@@ -71,7 +81,10 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
             assert( pGb->getGenerators()[critPair.mP1].nrTerms() != 0 );
             assert( pGb->getGenerators()[critPair.mP2].nrTerms() != 0 );
 			Polynomial spol = carl::SPolynomial(pGb->getGenerators()[critPair.mP1], pGb->getGenerators()[critPair.mP2]);
-			spol.setReasons(pGb->getGenerators()[critPair.mP1].getReasons() | pGb->getGenerators()[critPair.mP2].getReasons());
+			if(Polynomial::Policy::has_reasons)
+			{
+				spol.setReasons(pGb->getGenerators()[critPair.mP1].getReasons() | pGb->getGenerators()[critPair.mP2].getReasons());
+			}
 			CARL_LOG_DEBUG("carl.gb.buchberger", "SPol: " << spol);
 			// Schedules the S-polynomial for reduction
 			Reductor<Polynomial, Polynomial> reductor(*pGb, spol);
@@ -101,6 +114,70 @@ void Buchberger<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>
 	mGbElementsIndices.clear();
 }
 
+template<class Polynomial, template<typename> class AddingPolicy>
+bool Buchberger<Polynomial, AddingPolicy>::reduceBatch()
+{
+	std::vector<SPolPair> batch;
+	batch.push_back(pCritPairs->pop());
+	uint degree = batch.front().mLcm->tdeg();
+	while(!pCritPairs->empty() && pCritPairs->top().mLcm->tdeg() == degree)
+	{
+		batch.push_back(pCritPairs->pop());
+	}
+	CARL_LOG_DEBUG("carl.gb.buchberger", "Reducing " << batch.size() << " pairs of degree " << degree);
+
+	const std::vector<Polynomial>& generators = pGb->getGenerators();
+	std::vector<Polynomial> remainders(batch.size());
+	std::atomic<std::size_t> next(0);
+	auto worker = [&]()
+	{
+		// The divisor lookup of an ideal is not thread-safe, hence every thread works on its own copy.
+		Ideal<Polynomial> snapshot(*pGb);
+		for(std::size_t i = next++; i < batch.size(); i = next++)
+		{
+			const SPolPair& critPair = batch[i];
+			Polynomial spol = carl::SPolynomial(generators[critPair.mP1], generators[critPair.mP2]);
+			if(Polynomial::Policy::has_reasons)
+			{
+				spol.setReasons(generators[critPair.mP1].getReasons() | generators[critPair.mP2].getReasons());
+			}
+			Reductor<Polynomial, Polynomial> reductor(snapshot, spol);
+			remainders[i] = reductor.fullReduce();
+		}
+	};
+	std::size_t threads = std::min(mThreads, batch.size());
+	if(threads > 1)
+	{
+		std::vector<std::thread> pool;
+		for(std::size_t t = 0; t < threads; t++)
+		{
+			pool.emplace_back(worker);
+		}
+		for(auto& t : pool) t.join();
+	}
+	else
+	{
+		worker();
+	}
+
+	// The remainders are reduced by the polynomials added before, hence they are inter-reduced.
+	for(const Polynomial& remainder : remainders)
+	{
+		if(remainder.isZero()) continue;
+		Reductor<Polynomial, Polynomial> reductor(*pGb, remainder);
+		Polynomial reduced = reductor.fullReduce();
+		CARL_LOG_DEBUG("carl.gb.buchberger", "Remainder of SPol: " << reduced);
+		if(reduced.isZero()) continue;
+		if(reduced.isConstant())
+		{
+			pGb->clear();
+			pGb->addGenerator(reduced.normalize());
+			return true;
+		}
+		if(addToGb(reduced.normalize())) return true;
+	}
+	return false;
+}
 
 //
 /**
@@ -0,0 +1,90 @@
+/**
+ * @file   F4.h
+ * @ingroup gb
+ *
+ * F4 style computation of Groebner bases.
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+
+#include <list>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Faugere's F4 algorithm with the pair management of the Buchberger procedure.
+ *
+ * Instead of reducing one S-polynomial at a time, all critical pairs whose lcm has minimal degree are selected at once.
+ * The multiples of the generators needed to reduce these S-polynomials are collected by a symbolic preprocessing
+ * which uses the divisor lookup of the ideal. The resulting Macaulay matrix is brought into row echelon form
+ * by sparse elimination over the coefficient field, and all rows with a new leading monomial are added to the basis.
+ * The criteria of Gebauer and Moeller are applied by the update of the Buchberger procedure.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F4 : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+	/// A row of the Macaulay matrix, as pairs of column and coefficient sorted by column.
+	using Row = std::vector<std::pair<std::size_t, Coeff>>;
+protected:
+	using Super::pGb;
+	using Super::mGbElementsIndices;
+	using Super::pCritPairs;
+
+public:
+	F4() = default;
+	F4(const F4& rhs) = default;
+	~F4() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+	/// Number of matrices which were reduced by the last call to calculate.
+	std::size_t nrMatrices() const
+	{
+		return mNrMatrices;
+	}
+	/// Number of rows of the largest matrix which was reduced by the last call to calculate.
+	std::size_t maxMatrixRows() const
+	{
+		return mMaxMatrixRows;
+	}
+
+protected:
+	/**
+	 * Removes all critical pairs with an lcm of minimal degree.
+	 * @return The selected pairs.
+	 */
+	std::vector<SPolPair> selectPairs();
+	/**
+	 * Reduces the S-polynomials of the given pairs and adds the results to the Groebner basis.
+	 * @return true, if a constant polynomial was added.
+	 */
+	bool reduceCriticalPairs(const std::vector<SPolPair>& pairs);
+
+private:
+	std::size_t mNrMatrices = 0;
+	std::size_t mMaxMatrixRows = 0;
+
+	/// Divides the row by its leading coefficient.
+	static void makeMonic(Row& row);
+	/**
+	 * Reduces the row by all pivot rows, which have a leading coefficient of one.
+	 * @param dense Zero vector with an entry for every column, used as accumulator.
+	 * @param reasons If not null, the reasons of all pivot rows used are added.
+	 * @param rowReasons The reasons of all rows.
+	 */
+	static void reduceRow(Row& row, std::vector<Coeff>& dense, const std::map<std::size_t, std::size_t>& pivots, const std::vector<Row>& rows, BitVector* reasons, const std::vector<BitVector>& rowReasons);
+};
+
+}
+
+#include "F4.tpp"
@@ -0,0 +1,228 @@
+/**
+ * @file F4.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F4.h"
+
+#include <algorithm>
+#include <set>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f4", "Calculate gb");
+	mNrMatrices = 0;
+	mMaxMatrixRows = 0;
+	for(std::size_t i = 0; i < pGb->getGenerators().size(); ++i)
+	{
+		mGbElementsIndices.push_back(i);
+	}
+
+	bool foundGB = false;
+	for(const Polynomial& newPol : scheduledForAdding)
+	{
+		if(this->addToGb(newPol))
+		{
+			CARL_LOG_INFO("carl.gb.f4", "Added a constant polynomial.");
+			foundGB = true;
+			break;
+		}
+	}
+
+	while(!foundGB && !pCritPairs->empty())
+	{
+		foundGB = reduceCriticalPairs(selectPairs());
+	}
+	mGbElementsIndices.clear();
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+std::vector<SPolPair> F4<Polynomial, AddingPolicy>::selectPairs()
+{
+	// The pairs are ordered by a degree ordering of their lcms, independent of the ordering of the polynomials.
+	// Hence, the pairs of minimal degree are exactly those at the front of the queue.
+	static_assert(CritPairs::Order::degreeOrder, "F4 requires the critical pairs to be ordered by degree");
+	std::vector<SPolPair> pairs;
+	pairs.push_back(pCritPairs->pop());
+	uint degree = pairs.front().mLcm->tdeg();
+	while(!pCritPairs->empty() && pCritPairs->top().mLcm->tdeg() == degree)
+	{
+		pairs.push_back(pCritPairs->pop());
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Selected " << pairs.size() << " pairs of degree " << degree);
+	return pairs;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F4<Polynomial, AddingPolicy>::reduceCriticalPairs(const std::vector<SPolPair>& pairs)
+{
+	const std::vector<Polynomial>& generators = pGb->getGenerators();
+	// The multiples m*g of generators forming the rows, the monomials occurring in them,
+	// and the monomials which are the leading monomial of some row.
+	std::set<std::pair<const Polynomial*, Monomial::Arg>> multiplesSet;
+	std::vector<Polynomial> rowPolynomials;
+	// The reasons of every row, which are those of the generators combined in this row.
+	std::vector<BitVector> rowReasons;
+	std::set<Monomial::Arg, Ordering> monomials;
+	std::set<Monomial::Arg, Ordering> leadingMonomials;
+	std::vector<Monomial::Arg> todo;
+
+	auto addRow = [&](const Polynomial* g, const Monomial::Arg& factor)
+	{
+		if(!multiplesSet.emplace(g, factor).second) return;
+		rowPolynomials.push_back(factor ? *g * Term<Coeff>(Coeff(1), factor) : *g);
+		if(Polynomial::Policy::has_reasons) rowReasons.push_back(g->getReasons());
+		leadingMonomials.insert(rowPolynomials.back().lmon());
+		for(const auto& term : rowPolynomials.back())
+		{
+			if(monomials.insert(term.monomial()).second) todo.push_back(term.monomial());
+		}
+	};
+
+	for(const SPolPair& pair : pairs)
+	{
+		for(std::size_t index : {pair.mP1, pair.mP2})
+		{
+			Monomial::Arg factor;
+			pair.mLcm->divide(generators[index].lmon(), factor);
+			addRow(&generators[index], factor);
+		}
+	}
+
+	// Symbolic preprocessing: every monomial which is divisible by some leading monomial gets a reducer.
+	for(std::size_t i = 0; i < todo.size(); ++i)
+	{
+		Monomial::Arg m = todo[i];
+		if(leadingMonomials.count(m) > 0) continue;
+		DivisionLookupResult<Polynomial> divres = pGb->getDivisor(Term<Coeff>(Coeff(1), m));
+		if(divres.success())
+		{
+			addRow(divres.mDivisor, divres.mFactor.monomial());
+		}
+	}
+
+	// Columns are sorted by the monomial ordering, starting with the largest monomial.
+	std::vector<Monomial::Arg> columns(monomials.rbegin(), monomials.rend());
+	std::map<Monomial::Arg, std::size_t, Ordering> columnIndex;
+	for(std::size_t c = 0; c < columns.size(); ++c) columnIndex.emplace(columns[c], c);
+
+	std::vector<Row> rows;
+	rows.reserve(rowPolynomials.size());
+	for(const Polynomial& p : rowPolynomials)
+	{
+		Row row;
+		row.reserve(p.nrTerms());
+		for(const auto& term : p)
+		{
+			row.emplace_back(columnIndex.at(term.monomial()), term.coeff());
+		}
+		std::sort(row.begin(), row.end(), [](const std::pair<std::size_t, Coeff>& a, const std::pair<std::size_t, Coeff>& b){ return a.first < b.first; });
+		rows.push_back(std::move(row));
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Matrix of size " << rows.size() << " x " << columns.size());
+	++mNrMatrices;
+	mMaxMatrixRows = std::max(mMaxMatrixRows, rows.size());
+
+	// The first row for every leading monomial becomes a pivot as it is, all other rows are reduced by the pivots
+	// and become pivots for new leading monomials. Hence, the original leading monomials are exactly those of the first pivots.
+	std::vector<std::size_t> order(rows.size());
+	for(std::size_t r = 0; r < rows.size(); ++r) order[r] = r;
+	std::stable_sort(order.begin(), order.end(), [&rows](std::size_t a, std::size_t b){
+		if(rows[a].front().first != rows[b].front().first) return rows[a].front().first < rows[b].front().first;
+		return rows[a].size() < rows[b].size();
+	});
+
+	std::map<std::size_t, std::size_t> pivots;
+	std::vector<std::size_t> toReduce;
+	for(std::size_t r : order)
+	{
+		if(pivots.count(rows[r].front().first) > 0)
+		{
+			toReduce.push_back(r);
+			continue;
+		}
+		makeMonic(rows[r]);
+		pivots.emplace(rows[r].front().first, r);
+	}
+	std::vector<Coeff> dense(columns.size(), Coeff(0));
+	std::vector<std::size_t> newPivots;
+	for(std::size_t r : toReduce)
+	{
+		reduceRow(rows[r], dense, pivots, rows, Polynomial::Policy::has_reasons ? &rowReasons[r] : nullptr, rowReasons);
+		if(rows[r].empty()) continue;
+		makeMonic(rows[r]);
+		pivots.emplace(rows[r].front().first, r);
+		newPivots.push_back(r);
+	}
+	std::sort(newPivots.begin(), newPivots.end(), [&rows](std::size_t a, std::size_t b){ return rows[a].front().first < rows[b].front().first; });
+
+	// Rows with new leading monomials are added to the basis, those with larger leading monomials first,
+	// such that they may be eliminated by the following ones.
+	std::vector<Polynomial> newPolynomials;
+	for(std::size_t r : newPivots)
+	{
+		typename Polynomial::TermsType terms;
+		terms.reserve(rows[r].size());
+		for(const auto& entry : rows[r])
+		{
+			terms.emplace_back(entry.second, columns[entry.first]);
+		}
+		newPolynomials.emplace_back(std::move(terms), false, false);
+		if(Polynomial::Policy::has_reasons)
+		{
+			newPolynomials.back().setReasons(rowReasons[r]);
+		}
+	}
+	CARL_LOG_DEBUG("carl.gb.f4", "Found " << newPolynomials.size() << " new polynomials");
+	for(const Polynomial& p : newPolynomials)
+	{
+		CARL_LOG_DEBUG("carl.gb.f4", "New polynomial: " << p);
+		if(this->addToGb(p)) return true;
+	}
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::makeMonic(Row& row)
+{
+	Coeff lc = row.front().second;
+	if(carl::isOne(lc)) return;
+	for(auto& entry : row) entry.second /= lc;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F4<Polynomial, AddingPolicy>::reduceRow(Row& row, std::vector<Coeff>& dense, const std::map<std::size_t, std::size_t>& pivots, const std::vector<Row>& rows, BitVector* reasons, const std::vector<BitVector>& rowReasons)
+{
+	std::size_t first = row.front().first;
+	for(auto& entry : row) dense[entry.first] = std::move(entry.second);
+	row.clear();
+	// Eliminate the columns from left to right, the pivots only add entries right of their leading column.
+	for(std::size_t c = first; c < dense.size(); ++c)
+	{
+		if(carl::isZero(dense[c])) continue;
+		auto it = pivots.find(c);
+		if(it == pivots.end())
+		{
+			row.emplace_back(c, std::move(dense[c]));
+			dense[c] = 0;
+			continue;
+		}
+		Coeff factor = std::move(dense[c]);
+		dense[c] = 0;
+		const Row& pivot = rows[it->second];
+		if(reasons != nullptr) reasons->calculateUnion(rowReasons[it->second]);
+		for(auto p = pivot.begin() + 1; p != pivot.end(); ++p)
+		{
+			dense[p->first] -= factor * p->second;
+		}
+	}
+}
+
+}
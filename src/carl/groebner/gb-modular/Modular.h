@@ -0,0 +1,386 @@
+/**
+ * @file   Modular.h
+ * @ingroup gb
+ *
+ * Modular computation of Groebner bases over the rationals.
+ */
+
+#pragma once
+
+#include "ModularF4.h"
+#include "../gb-f4/F4.h"
+#include "../../core/polynomialfunctions/SPolynomial.h"
+
+#include <boost/optional.hpp>
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace carl
+{
+namespace modular_groebner
+{
+	/**
+	 * Reconstructs a rational number r/s from its residue a modulo m, such that |r| and s are at most sqrt(m/2).
+	 * @return The rational number, or boost::none if no such number exists.
+	 */
+	template<typename Integer, typename Rational>
+	boost::optional<Rational> rationalReconstruction(const Integer& a, const Integer& m)
+	{
+		Integer bound;
+		Integer half = m / 2;
+		mpz_sqrt(bound.get_mpz_t(), half.get_mpz_t());
+		Integer r0 = m;
+		Integer r1 = carl::mod(a, m);
+		if(r1 < 0) r1 += m;
+		Integer s0 = 0;
+		Integer s1 = 1;
+		while(r1 > bound)
+		{
+			Integer q = r0 / r1;
+			Integer r2 = r0 - q * r1;
+			Integer s2 = s0 - q * s1;
+			r0 = r1;
+			r1 = r2;
+			s0 = s1;
+			s1 = s2;
+		}
+		if(s1 == 0 || carl::abs(s1) > bound || carl::gcd(r1, s1) != 1) return boost::none;
+		return Rational(r1) / Rational(s1);
+	}
+}
+
+/**
+ * Computes reduced Groebner bases of ideals over the rationals by computing them modulo several word-sized primes.
+ *
+ * For every prime, the reduced Groebner basis over Z_p is computed by ModularF4, where primes dividing a denominator or
+ * a leading coefficient of the input are skipped. Primes are grouped by the leading monomials of their bases and the group
+ * with the most primes is assumed to consist of lucky primes. Its coefficients are lifted by chinese remaindering and
+ * rational reconstruction. Once the reconstruction is stable for one additional prime, the result is verified over the
+ * rationals: all input polynomials have to reduce to zero and all S-polynomials of the basis have to reduce to zero.
+ * This proves that the result is a Groebner basis of an ideal containing the input.
+ * That the basis is contained in the ideal of the input is checked modulo a prime that was not used for the lift,
+ * which only accepts a basis of a larger ideal for finitely many primes.
+ * @ingroup gb
+ */
+template<typename Polynomial>
+class ModularGroebner
+{
+	using Coeff = typename Polynomial::CoeffType;
+	using Integer = typename IntegralType<Coeff>::type;
+	using Ordering = typename Polynomial::OrderedBy;
+	using ModPolynomial = modular_groebner::ModPolynomial;
+	using ModInt = modular_groebner::ModInt;
+public:
+	struct Settings
+	{
+		/// Number of primes whose bases are computed concurrently. Without THREAD_SAFE, everything is sequential.
+		std::size_t threads = 1;
+		/// The computation fails if no verified basis was found with this many primes.
+		std::size_t maxPrimes = 256;
+	};
+	struct Statistics
+	{
+		/// Number of primes whose bases were computed.
+		std::size_t primes = 0;
+		/// Number of primes that were skipped or whose leading monomials disagreed with the final result.
+		std::size_t unluckyPrimes = 0;
+		/// Number of failed verifications.
+		std::size_t failedVerifications = 0;
+	};
+private:
+	/// Chinese remainders of the coefficients of bases with the same leading monomials.
+	struct Lift
+	{
+		std::vector<std::map<Monomial::Arg, Integer, Ordering>> coefficients;
+		Integer modulus = 1;
+		std::size_t primes = 0;
+		/// Number of primes when the coefficients were reconstructed the last time.
+		std::size_t reconstructedPrimes = 0;
+		std::vector<Polynomial> lastReconstruction;
+	};
+
+	Settings mSettings;
+	Statistics mStatistics;
+	std::size_t mNextPrime = 0;
+
+	static bool greater(const Monomial::Arg& m1, const Monomial::Arg& m2)
+	{
+		return Ordering::less(m2, m1);
+	}
+
+	/// Reduces the polynomials modulo p, or returns boost::none if p divides a denominator or a leading coefficient.
+	static boost::optional<std::vector<ModPolynomial>> reduce(const std::vector<Polynomial>& input, ModInt p)
+	{
+		std::vector<ModPolynomial> res;
+		for(const Polynomial& f : input)
+		{
+			if(f.isZero()) continue;
+			ModPolynomial g;
+			for(const auto& t : f)
+			{
+				ModInt den = modular_resultant::residue(Integer(carl::getDenom(t.coeff())), p);
+				if(den == 0) return boost::none;
+				ModInt c = modular_resultant::mulmod(modular_resultant::residue(Integer(carl::getNum(t.coeff())), p), modular_resultant::invmod(den, p), p);
+				if(c != 0) g.emplace_back(t.monomial(), c);
+				else if(t.monomial() == f.lmon()) return boost::none;
+			}
+			std::sort(g.begin(), g.end(), [](const std::pair<Monomial::Arg, ModInt>& a, const std::pair<Monomial::Arg, ModInt>& b){ return greater(a.first, b.first); });
+			res.push_back(std::move(g));
+		}
+		return res;
+	}
+
+	/// Computes the reduced Groebner bases for the given primes, possibly in parallel.
+	std::vector<boost::optional<std::vector<ModPolynomial>>> compute(const std::vector<Polynomial>& input, const std::vector<ModInt>& primes) const
+	{
+		std::vector<boost::optional<std::vector<ModPolynomial>>> results(primes.size());
+		std::atomic<std::size_t> next(0);
+		auto worker = [&]() {
+			for(std::size_t i = next++; i < primes.size(); i = next++)
+			{
+				auto reduced = reduce(input, primes[i]);
+				if(!reduced) continue;
+				modular_groebner::ModularF4<Ordering> f4(primes[i]);
+				results[i] = f4.calculate(*reduced);
+			}
+		};
+#ifdef THREAD_SAFE
+		std::size_t threads = std::min(mSettings.threads, primes.size());
+		if(threads > 1)
+		{
+			std::vector<std::thread> pool;
+			for(std::size_t t = 0; t < threads; t++)
+			{
+				pool.emplace_back(worker);
+			}
+			for(auto& t : pool) t.join();
+			return results;
+		}
+#endif
+		worker();
+		return results;
+	}
+
+	/// Adds the basis modulo p to the chinese remainders.
+	static void combine(Lift& lift, const std::vector<ModPolynomial>& basis, ModInt p)
+	{
+		using namespace modular_resultant;
+		if(lift.coefficients.empty()) lift.coefficients.resize(basis.size());
+		ModInt inv = invmod(residue(lift.modulus, p), p);
+		for(std::size_t i = 0; i < basis.size(); ++i)
+		{
+			std::map<Monomial::Arg, ModInt, Ordering> residues(basis[i].begin(), basis[i].end());
+			for(const auto& t : basis[i]) lift.coefficients[i].emplace(t.first, Integer(0));
+			for(auto& c : lift.coefficients[i])
+			{
+				auto it = residues.find(c.first);
+				ModInt target = (it == residues.end()) ? 0 : it->second;
+				ModInt diff = (target + p - residue(c.second, p)) % p;
+				c.second += lift.modulus * Integer(mulmod(diff, inv, p));
+			}
+		}
+		lift.modulus *= Integer(p);
+		lift.primes++;
+	}
+
+	/// Reconstructs rational coefficients from the chinese remainders.
+	static boost::optional<std::vector<Polynomial>> reconstruct(const Lift& lift)
+	{
+		std::vector<Polynomial> res;
+		for(const auto& coefficients : lift.coefficients)
+		{
+			typename Polynomial::TermsType terms;
+			for(const auto& c : coefficients)
+			{
+				if(carl::isZero(c.second)) continue;
+				auto r = modular_groebner::rationalReconstruction<Integer, Coeff>(c.second, lift.modulus);
+				if(!r) return boost::none;
+				terms.emplace_back(*r, c.first);
+			}
+			res.emplace_back(std::move(terms), false, false);
+		}
+		return res;
+	}
+
+	/**
+	 * Checks that the basis is contained in the ideal of the input modulo the next prime, which was not used for the lift.
+	 * The reduced Groebner bases of the input and of the input together with the basis coincide modulo p if and only if
+	 * the basis is contained in the ideal of the input modulo p.
+	 */
+	bool containedModulo(const std::vector<Polynomial>& input, const std::vector<Polynomial>& basis)
+	{
+		for(std::size_t i = 0; i < mSettings.maxPrimes; ++i)
+		{
+			ModInt p = modular_resultant::prime(mNextPrime++);
+			auto f = reduce(input, p);
+			auto g = reduce(basis, p);
+			if(!f || !g) continue;
+			modular_groebner::ModularF4<Ordering> f4(p);
+			std::vector<ModPolynomial> gb = f4.calculate(*f);
+			f->insert(f->end(), g->begin(), g->end());
+			return f4.calculate(*f) == gb;
+		}
+		return false;
+	}
+
+	/**
+	 * Checks that the input reduces to zero modulo the basis, that the basis is a Groebner basis
+	 * and that the basis is contained in the ideal of the input, see containedModulo().
+	 */
+	bool verify(const std::vector<Polynomial>& input, const std::vector<Polynomial>& basis)
+	{
+		Ideal<Polynomial> ideal;
+		for(const Polynomial& g : basis) ideal.addGenerator(g);
+		auto reducesToZero = [&ideal](const Polynomial& p)
+		{
+			Reductor<Polynomial, Polynomial> reductor(ideal, p);
+			return reductor.fullReduce().isZero();
+		};
+		for(const Polynomial& f : input)
+		{
+			if(!reducesToZero(f)) return false;
+		}
+		for(std::size_t i = 0; i < basis.size(); ++i)
+		{
+			for(std::size_t j = i + 1; j < basis.size(); ++j)
+			{
+				const Monomial::Arg& m1 = basis[i].lmon();
+				const Monomial::Arg& m2 = basis[j].lmon();
+				if(Monomial::lcm(m1, m2)->tdeg() == m1->tdeg() + m2->tdeg()) continue;
+				if(!reducesToZero(carl::SPolynomial(basis[i], basis[j]))) return false;
+			}
+		}
+		return containedModulo(input, basis);
+	}
+
+public:
+	explicit ModularGroebner(const Settings& settings = Settings()): mSettings(settings) {}
+
+	Settings& settings()
+	{
+		return mSettings;
+	}
+	/// Statistics of the last call to calculate().
+	const Statistics& statistics() const
+	{
+		return mStatistics;
+	}
+
+	/**
+	 * Computes the reduced Groebner basis of the ideal generated by the input.
+	 * @param input Polynomials with rational coefficients.
+	 * @return The reduced Groebner basis, or boost::none if no basis could be verified with the maximum number of primes.
+	 */
+	boost::optional<std::vector<Polynomial>> calculate(const std::vector<Polynomial>& input)
+	{
+		mStatistics = Statistics();
+		std::map<std::vector<Monomial::Arg>, Lift> lifts;
+		while(mStatistics.primes < mSettings.maxPrimes)
+		{
+			std::vector<ModInt> primes;
+			std::size_t batch = std::min(std::max(mSettings.threads, std::size_t(1)), mSettings.maxPrimes - mStatistics.primes);
+			while(primes.size() < batch) primes.push_back(modular_resultant::prime(mNextPrime++));
+			auto results = compute(input, primes);
+			for(std::size_t i = 0; i < primes.size(); ++i)
+			{
+				mStatistics.primes++;
+				if(!results[i])
+				{
+					CARL_LOG_DEBUG("carl.gb.modular", "Skipping unlucky prime " << primes[i]);
+					mStatistics.unluckyPrimes++;
+					continue;
+				}
+				std::vector<Monomial::Arg> leadingMonomials;
+				for(const auto& g : *results[i]) leadingMonomials.push_back(g.front().first);
+				Lift& lift = lifts[leadingMonomials];
+				combine(lift, *results[i], primes[i]);
+			}
+			// Continue with the lift of the majority of primes.
+			auto best = lifts.begin();
+			for(auto it = lifts.begin(); it != lifts.end(); ++it)
+			{
+				if(it->second.primes > best->second.primes) best = it;
+			}
+			if(best == lifts.end()) continue;
+			Lift& lift = best->second;
+			// Stability is only meaningful if the lift was extended since the last reconstruction.
+			if(lift.primes == lift.reconstructedPrimes) continue;
+			lift.reconstructedPrimes = lift.primes;
+			auto basis = reconstruct(lift);
+			if(!basis) continue;
+			if(*basis != lift.lastReconstruction)
+			{
+				lift.lastReconstruction = *basis;
+				continue;
+			}
+			if(verify(input, *basis))
+			{
+				mStatistics.unluckyPrimes = mStatistics.primes - lift.primes;
+				CARL_LOG_DEBUG("carl.gb.modular", "Verified basis after " << mStatistics.primes << " primes");
+				return basis;
+			}
+			CARL_LOG_DEBUG("carl.gb.modular", "Verification failed after " << mStatistics.primes << " primes");
+			mStatistics.failedVerifications++;
+		}
+		return boost::none;
+	}
+};
+
+/**
+ * Modular procedure for GBProcedure.
+ *
+ * Every call to calculate computes the reduced Groebner basis of the current basis and the scheduled polynomials
+ * with ModularGroebner and replaces the current basis by the result.
+ * If the modular computation fails, the basis is computed by F4 over the rationals instead.
+ * As the modular computation does not know which input polynomials contribute to an element of the basis,
+ * polynomials with reasons are always handled by F4, which tracks the reasons of every element.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class Modular : public F4<Polynomial, AddingPolicy>
+{
+	using Super = F4<Polynomial, AddingPolicy>;
+protected:
+	using Super::pGb;
+private:
+	ModularGroebner<Polynomial> mModular;
+public:
+	Modular() = default;
+	Modular(const Modular& rhs) = default;
+	~Modular() override = default;
+
+	/// The modular computation used by calculate.
+	ModularGroebner<Polynomial>& modular()
+	{
+		return mModular;
+	}
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding)
+	{
+		if(Polynomial::Policy::has_reasons)
+		{
+			Super::calculate(scheduledForAdding);
+			return;
+		}
+		std::vector<Polynomial> input(pGb->getGenerators().begin(), pGb->getGenerators().end());
+		input.insert(input.end(), scheduledForAdding.begin(), scheduledForAdding.end());
+		auto basis = mModular.calculate(input);
+		if(!basis)
+		{
+			CARL_LOG_INFO("carl.gb.modular", "Modular computation failed, computing over the rationals");
+			Super::calculate(scheduledForAdding);
+			return;
+		}
+		pGb->clear();
+		for(const Polynomial& g : *basis)
+		{
+			pGb->addGenerator(g);
+		}
+	}
+};
+
+}
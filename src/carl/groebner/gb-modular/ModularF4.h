@@ -0,0 +1,377 @@
+/**
+ * @file   ModularF4.h
+ * @ingroup gb
+ *
+ * Computation of reduced Groebner bases over Z_p for word-sized primes.
+ */
+
+#pragma once
+
+#include "../../core/Monomial.h"
+#include "../../core/polynomialfunctions/ModularResultant.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+namespace modular_groebner
+{
+
+	using modular_resultant::ModInt;
+	using modular_resultant::mulmod;
+	using modular_resultant::invmod;
+
+	/// Polynomial over Z_p as terms with nonzero coefficients, sorted decreasingly by the monomial ordering.
+	using ModPolynomial = std::vector<std::pair<Monomial::Arg, ModInt>>;
+
+/**
+ * F4 style computation of the reduced Groebner basis of an ideal over Z_p.
+ *
+ * Polynomials are plain term vectors with residues in [0, p) and only monomials are shared with the rest of carl,
+ * hence several instances may run concurrently for different primes.
+ * Critical pairs are filtered by the criteria of Gebauer and Moeller, all pairs of minimal degree are reduced at once
+ * by sparse elimination of the Macaulay matrix, and the result is interreduced by a final reduced row echelon form.
+ * @ingroup gb
+ */
+template<typename Ordering>
+class ModularF4
+{
+	/// A row of the Macaulay matrix, as pairs of column and coefficient sorted by column.
+	using Row = std::vector<std::pair<std::size_t, ModInt>>;
+	struct Pair
+	{
+		std::size_t p1;
+		std::size_t p2;
+		Monomial::Arg lcm;
+	};
+
+	ModInt mPrime;
+	std::vector<ModPolynomial> mBasis;
+	/// Whether the leading monomial of a basis element is divisible by the leading monomial of a later one.
+	std::vector<bool> mRedundant;
+	std::vector<Pair> mPairs;
+	std::size_t mNrMatrices = 0;
+
+	static bool greater(const Monomial::Arg& m1, const Monomial::Arg& m2)
+	{
+		return Ordering::less(m2, m1);
+	}
+	static bool coprime(const Monomial::Arg& m1, const Monomial::Arg& m2)
+	{
+		return Monomial::lcm(m1, m2)->tdeg() == m1->tdeg() + m2->tdeg();
+	}
+
+	/// Makes the polynomial monic.
+	void normalize(ModPolynomial& p) const
+	{
+		assert(!p.empty());
+		if(p.front().second == 1) return;
+		ModInt inv = invmod(p.front().second, mPrime);
+		for(auto& t : p) t.second = mulmod(t.second, inv, mPrime);
+	}
+
+	/// Returns the index of a non-redundant basis element whose leading monomial divides m, or mBasis.size().
+	std::size_t findReducer(const Monomial::Arg& m) const
+	{
+		for(std::size_t i = 0; i < mBasis.size(); ++i)
+		{
+			if(!mRedundant[i] && m->divisible(mBasis[i].front().first)) return i;
+		}
+		return mBasis.size();
+	}
+
+	/**
+	 * Adds a monic polynomial to the basis and updates the critical pairs.
+	 * @return true, if the polynomial is constant.
+	 */
+	bool add(ModPolynomial&& p)
+	{
+		std::size_t index = mBasis.size();
+		const Monomial::Arg& lm = p.front().first;
+		if(!lm)
+		{
+			mBasis.assign(1, std::move(p));
+			mRedundant.assign(1, false);
+			mPairs.clear();
+			return true;
+		}
+		// Criterion B: remove old pairs whose lcm is a multiple of lm, unless the lcm of lm with one of the elements equals it.
+		mPairs.erase(std::remove_if(mPairs.begin(), mPairs.end(), [&](const Pair& pair){
+			if(!pair.lcm->divisible(lm)) return false;
+			return Monomial::lcm(mBasis[pair.p1].front().first, lm) != pair.lcm && Monomial::lcm(mBasis[pair.p2].front().first, lm) != pair.lcm;
+		}), mPairs.end());
+
+		std::vector<Pair> newPairs;
+		for(std::size_t i = 0; i < index; ++i)
+		{
+			if(mRedundant[i]) continue;
+			newPairs.push_back(Pair{ i, index, Monomial::lcm(mBasis[i].front().first, lm) });
+		}
+		// Criterion M: remove pairs whose lcm is a proper multiple of the lcm of another new pair.
+		std::vector<Pair> filtered;
+		for(const Pair& pair : newPairs)
+		{
+			bool multiple = std::any_of(newPairs.begin(), newPairs.end(), [&pair](const Pair& other){
+				return other.lcm != pair.lcm && pair.lcm->divisible(other.lcm);
+			});
+			if(!multiple) filtered.push_back(pair);
+		}
+		// Criterion F: keep a single pair for every lcm, and none if one of these pairs is coprime.
+		std::map<Monomial::Arg, std::pair<std::size_t, bool>, Ordering> byLcm;
+		for(const Pair& pair : filtered)
+		{
+			bool isCoprime = coprime(mBasis[pair.p1].front().first, lm);
+			auto it = byLcm.find(pair.lcm);
+			if(it == byLcm.end()) byLcm.emplace(pair.lcm, std::make_pair(pair.p1, isCoprime));
+			else it->second.second = it->second.second || isCoprime;
+		}
+		for(const auto& entry : byLcm)
+		{
+			if(!entry.second.second) mPairs.push_back(Pair{ entry.second.first, index, entry.first });
+		}
+
+		for(std::size_t i = 0; i < index; ++i)
+		{
+			if(!mRedundant[i] && mBasis[i].front().first->divisible(lm)) mRedundant[i] = true;
+		}
+		mBasis.push_back(std::move(p));
+		mRedundant.push_back(false);
+		return false;
+	}
+
+	/// Removes all pairs whose lcm has minimal degree.
+	std::vector<Pair> selectPairs()
+	{
+		uint degree = std::min_element(mPairs.begin(), mPairs.end(), [](const Pair& a, const Pair& b){ return a.lcm->tdeg() < b.lcm->tdeg(); })->lcm->tdeg();
+		std::vector<Pair> selected;
+		std::vector<Pair> remaining;
+		for(Pair& pair : mPairs)
+		{
+			if(pair.lcm->tdeg() == degree) selected.push_back(std::move(pair));
+			else remaining.push_back(std::move(pair));
+		}
+		mPairs.swap(remaining);
+		return selected;
+	}
+
+	/// row -= factor * pivot, where the pivot starts at the entry at pos.
+	void subtract(Row& row, std::size_t pos, const Row& pivot) const
+	{
+		ModInt factor = row[pos].second;
+		Row result;
+		result.reserve(row.size() + pivot.size());
+		result.insert(result.end(), row.begin(), row.begin() + long(pos));
+		auto r = row.begin() + long(pos);
+		auto p = pivot.begin();
+		while(r != row.end() || p != pivot.end())
+		{
+			if(p == pivot.end() || (r != row.end() && r->first < p->first))
+			{
+				result.push_back(*r);
+				++r;
+			}
+			else if(r == row.end() || p->first < r->first)
+			{
+				result.emplace_back(p->first, mPrime - mulmod(factor, p->second, mPrime));
+				++p;
+			}
+			else
+			{
+				ModInt c = (r->second + mPrime - mulmod(factor, p->second, mPrime)) % mPrime;
+				if(c != 0) result.emplace_back(r->first, c);
+				++r;
+				++p;
+			}
+		}
+		row.swap(result);
+	}
+
+	/// Reduces all entries of the row starting at position start by the pivot rows, which are monic.
+	void reduceRow(Row& row, std::size_t start, const std::map<std::size_t, std::size_t>& pivots, const std::vector<Row>& rows) const
+	{
+		std::size_t pos = start;
+		while(pos < row.size())
+		{
+			auto it = pivots.find(row[pos].first);
+			if(it == pivots.end()) ++pos;
+			else subtract(row, pos, rows[it->second]);
+		}
+	}
+
+	/**
+	 * Builds the Macaulay matrix of the given multiples of basis elements with all reducers
+	 * and computes its reduced row echelon form.
+	 * @param multiples Pairs of basis index and multiplier.
+	 * @return The rows of the reduced row echelon form as polynomials, together with the leading monomials of the original rows.
+	 */
+	std::pair<std::vector<ModPolynomial>, std::set<Monomial::Arg, Ordering>> eliminate(const std::vector<std::pair<std::size_t, Monomial::Arg>>& multiples)
+	{
+		std::set<std::pair<std::size_t, Monomial::Arg>> multiplesSet;
+		std::vector<ModPolynomial> rowPolynomials;
+		std::set<Monomial::Arg, Ordering> monomials;
+		std::set<Monomial::Arg, Ordering> leadingMonomials;
+		std::vector<Monomial::Arg> todo;
+
+		auto addRow = [&](std::size_t index, const Monomial::Arg& factor)
+		{
+			if(!multiplesSet.emplace(index, factor).second) return;
+			ModPolynomial row;
+			row.reserve(mBasis[index].size());
+			for(const auto& t : mBasis[index]) row.emplace_back(factor ? t.first * factor : t.first, t.second);
+			leadingMonomials.insert(row.front().first);
+			for(const auto& t : row)
+			{
+				if(monomials.insert(t.first).second) todo.push_back(t.first);
+			}
+			rowPolynomials.push_back(std::move(row));
+		};
+		for(const auto& multiple : multiples) addRow(multiple.first, multiple.second);
+
+		// Symbolic preprocessing
+		for(std::size_t i = 0; i < todo.size(); ++i)
+		{
+			if(leadingMonomials.count(todo[i]) > 0 || !todo[i]) continue;
+			std::size_t reducer = findReducer(todo[i]);
+			if(reducer == mBasis.size()) continue;
+			Monomial::Arg factor;
+			todo[i]->divide(mBasis[reducer].front().first, factor);
+			addRow(reducer, factor);
+		}
+		++mNrMatrices;
+
+		std::vector<Monomial::Arg> columns(monomials.rbegin(), monomials.rend());
+		std::map<Monomial::Arg, std::size_t, Ordering> columnIndex;
+		for(std::size_t c = 0; c < columns.size(); ++c) columnIndex.emplace(columns[c], c);
+
+		std::vector<Row> rows;
+		rows.reserve(rowPolynomials.size());
+		for(const ModPolynomial& p : rowPolynomials)
+		{
+			Row row;
+			row.reserve(p.size());
+			for(const auto& t : p) row.emplace_back(columnIndex.at(t.first), t.second);
+			rows.push_back(std::move(row));
+		}
+
+		std::vector<std::size_t> order(rows.size());
+		for(std::size_t r = 0; r < rows.size(); ++r) order[r] = r;
+		std::stable_sort(order.begin(), order.end(), [&rows](std::size_t a, std::size_t b){
+			if(rows[a].front().first != rows[b].front().first) return rows[a].front().first < rows[b].front().first;
+			return rows[a].size() < rows[b].size();
+		});
+		std::map<std::size_t, std::size_t> pivots;
+		for(std::size_t r : order)
+		{
+			reduceRow(rows[r], 0, pivots, rows);
+			if(rows[r].empty()) continue;
+			ModInt inv = invmod(rows[r].front().second, mPrime);
+			for(auto& entry : rows[r]) entry.second = mulmod(entry.second, inv, mPrime);
+			pivots.emplace(rows[r].front().first, r);
+		}
+		// Back substitution, starting with the pivot of the smallest leading monomial.
+		for(auto it = pivots.rbegin(); it != pivots.rend(); ++it)
+		{
+			reduceRow(rows[it->second], 1, pivots, rows);
+		}
+
+		std::vector<ModPolynomial> result;
+		for(const auto& pivot : pivots)
+		{
+			ModPolynomial p;
+			p.reserve(rows[pivot.second].size());
+			for(const auto& entry : rows[pivot.second]) p.emplace_back(columns[entry.first], entry.second);
+			result.push_back(std::move(p));
+		}
+		return std::make_pair(std::move(result), std::move(leadingMonomials));
+	}
+
+public:
+	explicit ModularF4(ModInt prime): mPrime(prime) {}
+
+	/// Number of matrices reduced by the last call to calculate.
+	std::size_t nrMatrices() const
+	{
+		return mNrMatrices;
+	}
+
+	/**
+	 * Computes the reduced Groebner basis of the ideal generated by the input.
+	 * @param input Polynomials over Z_p, zero polynomials are ignored.
+	 * @return The reduced Groebner basis, sorted decreasingly by the leading monomials.
+	 */
+	std::vector<ModPolynomial> calculate(const std::vector<ModPolynomial>& input)
+	{
+		mBasis.clear();
+		mRedundant.clear();
+		mPairs.clear();
+		mNrMatrices = 0;
+		bool constant = false;
+		for(const ModPolynomial& p : input)
+		{
+			if(p.empty()) continue;
+			ModPolynomial q(p);
+			normalize(q);
+			if(add(std::move(q)))
+			{
+				constant = true;
+				break;
+			}
+		}
+
+		while(!constant && !mPairs.empty())
+		{
+			std::vector<std::pair<std::size_t, Monomial::Arg>> multiples;
+			for(const Pair& pair : selectPairs())
+			{
+				for(std::size_t index : {pair.p1, pair.p2})
+				{
+					Monomial::Arg factor;
+					pair.lcm->divide(mBasis[index].front().first, factor);
+					multiples.emplace_back(index, factor);
+				}
+			}
+			auto reduced = eliminate(multiples);
+			for(ModPolynomial& p : reduced.first)
+			{
+				if(reduced.second.count(p.front().first) > 0) continue;
+				if(add(std::move(p)))
+				{
+					constant = true;
+					break;
+				}
+			}
+		}
+
+		// Input polynomials may have been added after a divisor of their leading monomial.
+		for(std::size_t i = 0; i < mBasis.size(); ++i)
+		{
+			for(std::size_t j = 0; !mRedundant[i] && j < mBasis.size(); ++j)
+			{
+				if(j != i && !mRedundant[j] && mBasis[i].front().first->divisible(mBasis[j].front().first)) mRedundant[i] = true;
+			}
+		}
+		// Interreduce the minimal basis.
+		std::vector<std::pair<std::size_t, Monomial::Arg>> minimal;
+		std::set<Monomial::Arg, Ordering> leadingMonomials;
+		for(std::size_t i = 0; i < mBasis.size(); ++i)
+		{
+			if(mRedundant[i]) continue;
+			minimal.emplace_back(i, Monomial::Arg());
+			leadingMonomials.insert(mBasis[i].front().first);
+		}
+		std::vector<ModPolynomial> result;
+		for(ModPolynomial& p : eliminate(minimal).first)
+		{
+			if(leadingMonomials.count(p.front().first) > 0) result.push_back(std::move(p));
+		}
+		std::sort(result.begin(), result.end(), [](const ModPolynomial& a, const ModPolynomial& b){ return greater(a.front().first, b.front().first); });
+		return result;
+	}
+};
+
+}
+}
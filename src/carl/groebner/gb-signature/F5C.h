@@ -0,0 +1,142 @@
+/**
+ * @file   F5C.h
+ * @ingroup gb
+ *
+ * Signature-based computation of Groebner bases.
+ */
+
+#pragma once
+
+#include "../gb-buchberger/Buchberger.h"
+
+#include <list>
+#include <ostream>
+#include <set>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Signature-based computation of Groebner bases in the style of F5C by Eder and Perry.
+ *
+ * The generators are added one after another. For the i-th generator, every polynomial is labeled with a signature m*e_i,
+ * where the current basis of the previous generators has signature zero. S-pairs are processed by increasing signature and
+ * only reduced by polynomials of smaller signature. S-pairs whose signature is known to be the signature of a syzygy
+ * (it is divisible by a leading monomial of the previous basis, by the signature of a Koszul syzygy or of an earlier zero reduction)
+ * and S-pairs that can be rewritten by a polynomial which was added later are discarded without any reduction,
+ * as their reduction would yield zero or a redundant polynomial.
+ * After every generator, the basis is interreduced.
+ * Every labeled polynomial carries the reasons of the polynomials it was computed from, like the reductions in Buchberger.
+ *
+ * As every call to calculate continues from the current basis, the generators can be added incrementally.
+ * @ingroup gb
+ */
+template<typename Polynomial, template<typename> class AddingPolicy>
+class F5C : public Buchberger<Polynomial, AddingPolicy>
+{
+	using Super = Buchberger<Polynomial, AddingPolicy>;
+	using Coeff = typename Polynomial::CoeffType;
+	using Ordering = typename Polynomial::OrderedBy;
+protected:
+	using Super::pGb;
+
+public:
+	/// Statistics about the last call to calculate.
+	struct Statistics
+	{
+		/// Number of S-pairs which were formed.
+		std::size_t pairs = 0;
+		/// Number of S-pairs discarded because both multiples have the same signature.
+		std::size_t singularPairs = 0;
+		/// Number of S-pairs discarded because their signature is the signature of a syzygy.
+		std::size_t syzygyCriterion = 0;
+		/// Number of S-pairs discarded because a later polynomial has a signature dividing their signature.
+		std::size_t rewrittenCriterion = 0;
+		/// Number of polynomials which were reduced, including the generators.
+		std::size_t reductions = 0;
+		/// Number of reductions which yielded zero.
+		std::size_t zeroReductions = 0;
+		/// Number of reductions which were discarded because the result is singular top-reducible.
+		std::size_t singularReductions = 0;
+
+		/// Number of S-pairs which were discarded without any reduction.
+		std::size_t avoidedReductions() const
+		{
+			return singularPairs + syzygyCriterion + rewrittenCriterion;
+		}
+
+		friend std::ostream& operator<<(std::ostream& os, const Statistics& s)
+		{
+			os << "S-pairs: " << s.pairs << std::endl;
+			os << "\tdiscarded as singular: " << s.singularPairs << std::endl;
+			os << "\tdiscarded by syzygy criterion: " << s.syzygyCriterion << std::endl;
+			os << "\tdiscarded by rewritten criterion: " << s.rewrittenCriterion << std::endl;
+			os << "Reductions: " << s.reductions << std::endl;
+			os << "\tto zero: " << s.zeroReductions << std::endl;
+			os << "\tsingular top-reducible: " << s.singularReductions << std::endl;
+			return os << "Avoided reductions: " << s.avoidedReductions() << std::endl;
+		}
+	};
+
+	F5C() = default;
+	F5C(const F5C& rhs) = default;
+	~F5C() override = default;
+
+	void calculate(const std::list<Polynomial>& scheduledForAdding);
+
+	const Statistics& statistics() const
+	{
+		return mStatistics;
+	}
+
+private:
+	/// A polynomial labeled with the monomial of its signature.
+	struct Labeled
+	{
+		Monomial::Arg signature;
+		Polynomial polynomial;
+	};
+	/// An S-pair, represented by the multiple of the polynomial with the larger signature.
+	struct JPair
+	{
+		Monomial::Arg signature;
+		Monomial::Arg multiplier;
+		std::size_t element;
+	};
+	/// Orders S-pairs by their signature.
+	struct JPairLess
+	{
+		bool operator()(const JPair& lhs, const JPair& rhs) const
+		{
+			CompareResult cmp = Ordering::compare(lhs.signature, rhs.signature);
+			if(cmp != CompareResult::EQUAL) return cmp == CompareResult::LESS;
+			return lhs.element < rhs.element;
+		}
+	};
+
+	Statistics mStatistics;
+
+	/**
+	 * Extends the Groebner basis by the given polynomial.
+	 * @return true, if the basis became constant.
+	 */
+	bool addGenerator(std::vector<Polynomial>& basis, const Polynomial& generator);
+	/**
+	 * Reduces the polynomial with the given signature by the previous basis and by all labeled polynomials of smaller signature.
+	 * @param singular Is set, if the leading term can only be reduced by a polynomial of the same signature.
+	 */
+	Polynomial regularReduce(Polynomial p, const Monomial::Arg& signature, const Ideal<Polynomial>& previous, const std::vector<Labeled>& elements, bool& singular) const;
+	/// Makes the basis a reduced Groebner basis.
+	static void interreduce(std::vector<Polynomial>& basis);
+	/// Makes the polynomial monic, keeping its reasons.
+	static Polynomial normalize(const Polynomial& p);
+	/// Checks if d divides m, where nullptr denotes the constant monomial.
+	static bool divides(const Monomial::Arg& d, const Monomial::Arg& m);
+	/// Computes m / d, assuming that d divides m.
+	static Monomial::Arg quotient(const Monomial::Arg& m, const Monomial::Arg& d);
+};
+
+}
+
+#include "F5C.tpp"
@@ -0,0 +1,245 @@
+/**
+ * @file F5C.tpp
+ * @ingroup gb
+ */
+#pragma once
+#include "F5C.h"
+
+#include <algorithm>
+
+namespace carl
+{
+
+/**
+ * Calculate the Groebner basis
+ */
+template<class Polynomial, template<typename> class AddingPolicy>
+void F5C<Polynomial, AddingPolicy>::calculate(const std::list<Polynomial>& scheduledForAdding)
+{
+	CARL_LOG_INFO("carl.gb.f5c", "Calculate gb");
+	mStatistics = Statistics();
+	if(pGb->isConstant()) return;
+	std::vector<Polynomial> basis(pGb->getGenerators().begin(), pGb->getGenerators().end());
+	for(const Polynomial& generator : scheduledForAdding)
+	{
+		if(generator.isZero()) continue;
+		if(addGenerator(basis, generator))
+		{
+			CARL_LOG_INFO("carl.gb.f5c", "Added a constant polynomial.");
+			break;
+		}
+	}
+	CARL_LOG_DEBUG("carl.gb.f5c", "Statistics:" << std::endl << mStatistics);
+
+	pGb->clear();
+	for(const Polynomial& g : basis)
+	{
+		pGb->addGenerator(g);
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F5C<Polynomial, AddingPolicy>::addGenerator(std::vector<Polynomial>& basis, const Polynomial& generator)
+{
+	Ideal<Polynomial> previous;
+	for(const Polynomial& g : basis) previous.addGenerator(g);
+	++mStatistics.reductions;
+	Polynomial reduced = Reductor<Polynomial, Polynomial>(previous, generator).fullReduce();
+	if(reduced.isZero())
+	{
+		++mStatistics.zeroReductions;
+		return false;
+	}
+	if(reduced.isConstant())
+	{
+		basis.assign(1, normalize(reduced));
+		return true;
+	}
+
+	// Monomials m such that m*e_i is the signature of a syzygy.
+	std::vector<Monomial::Arg> syzygies;
+	for(const Polynomial& g : basis) syzygies.push_back(g.lmon());
+	std::vector<Labeled> elements;
+	std::set<JPair, JPairLess> pairs;
+
+	auto addElement = [&](const Monomial::Arg& signature, const Polynomial& p)
+	{
+		std::size_t index = elements.size();
+		for(const Polynomial& g : basis)
+		{
+			Monomial::Arg multiplier = quotient(Monomial::lcm(p.lmon(), g.lmon()), p.lmon());
+			++mStatistics.pairs;
+			if(!pairs.insert(JPair{multiplier * signature, multiplier, index}).second) ++mStatistics.rewrittenCriterion;
+		}
+		for(std::size_t j = 0; j < elements.size(); ++j)
+		{
+			const Labeled& e = elements[j];
+			// The Koszul syzygy e*p - p*e.
+			CompareResult koszul = Ordering::compare(e.polynomial.lmon() * signature, p.lmon() * e.signature);
+			if(koszul == CompareResult::GREATER) syzygies.push_back(e.polynomial.lmon() * signature);
+			else if(koszul == CompareResult::LESS) syzygies.push_back(p.lmon() * e.signature);
+
+			Monomial::Arg lcm = Monomial::lcm(p.lmon(), e.polynomial.lmon());
+			Monomial::Arg multiplier = quotient(lcm, p.lmon());
+			Monomial::Arg otherMultiplier = quotient(lcm, e.polynomial.lmon());
+			++mStatistics.pairs;
+			CompareResult cmp = Ordering::compare(multiplier * signature, otherMultiplier * e.signature);
+			bool inserted = true;
+			if(cmp == CompareResult::EQUAL) ++mStatistics.singularPairs;
+			else if(cmp == CompareResult::GREATER) inserted = pairs.insert(JPair{multiplier * signature, multiplier, index}).second;
+			else inserted = pairs.insert(JPair{otherMultiplier * e.signature, otherMultiplier, j}).second;
+			if(!inserted) ++mStatistics.rewrittenCriterion;
+		}
+		elements.push_back(Labeled{signature, normalize(p)});
+	};
+	addElement(nullptr, reduced);
+
+	while(!pairs.empty())
+	{
+		JPair pair = *pairs.begin();
+		pairs.erase(pairs.begin());
+		if(std::any_of(syzygies.begin(), syzygies.end(), [&pair](const Monomial::Arg& s){ return divides(s, pair.signature); }))
+		{
+			++mStatistics.syzygyCriterion;
+			continue;
+		}
+		bool rewritable = false;
+		for(std::size_t j = pair.element + 1; j < elements.size() && !rewritable; ++j)
+		{
+			rewritable = divides(elements[j].signature, pair.signature);
+		}
+		if(rewritable)
+		{
+			++mStatistics.rewrittenCriterion;
+			continue;
+		}
+
+		const Polynomial& p = elements[pair.element].polynomial;
+		++mStatistics.reductions;
+		bool singular = false;
+		Polynomial multiple = pair.multiplier ? p * Term<Coeff>(Coeff(1), pair.multiplier) : p;
+		if(Polynomial::Policy::has_reasons) multiple.setReasons(p.getReasons());
+		Polynomial remainder = regularReduce(multiple, pair.signature, previous, elements, singular);
+		if(singular)
+		{
+			++mStatistics.singularReductions;
+			continue;
+		}
+		if(remainder.isZero())
+		{
+			++mStatistics.zeroReductions;
+			syzygies.push_back(pair.signature);
+			continue;
+		}
+		CARL_LOG_DEBUG("carl.gb.f5c", "New polynomial " << remainder << " with signature " << pair.signature);
+		if(remainder.isConstant())
+		{
+			basis.assign(1, normalize(remainder));
+			return true;
+		}
+		addElement(pair.signature, remainder);
+	}
+
+	for(const Labeled& e : elements) basis.push_back(e.polynomial);
+	interreduce(basis);
+	return false;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Polynomial F5C<Polynomial, AddingPolicy>::regularReduce(Polynomial p, const Monomial::Arg& signature, const Ideal<Polynomial>& previous, const std::vector<Labeled>& elements, bool& singular) const
+{
+	typename Polynomial::TermsType remainder;
+	BitVector reasons;
+	if(Polynomial::Policy::has_reasons) reasons = p.getReasons();
+	bool top = true;
+	while(!p.isZero())
+	{
+		Term<Coeff> lt = p.lterm();
+		DivisionLookupResult<Polynomial> divres = previous.getDivisor(lt);
+		if(divres.success())
+		{
+			if(Polynomial::Policy::has_reasons) reasons.calculateUnion(divres.mDivisor->getReasons());
+			p += *divres.mDivisor * divres.mFactor;
+			continue;
+		}
+		bool reduced = false;
+		bool singularReducer = false;
+		for(const Labeled& e : elements)
+		{
+			if(!divides(e.polynomial.lmon(), lt.monomial())) continue;
+			Monomial::Arg multiplier = quotient(lt.monomial(), e.polynomial.lmon());
+			CompareResult cmp = Ordering::compare(multiplier * e.signature, signature);
+			if(cmp == CompareResult::LESS)
+			{
+				// The labeled polynomials are monic.
+				if(Polynomial::Policy::has_reasons) reasons.calculateUnion(e.polynomial.getReasons());
+				p -= e.polynomial * Term<Coeff>(lt.coeff(), multiplier);
+				reduced = true;
+				break;
+			}
+			if(cmp == CompareResult::EQUAL) singularReducer = true;
+		}
+		if(reduced) continue;
+		if(top && singularReducer)
+		{
+			singular = true;
+			return Polynomial();
+		}
+		top = false;
+		remainder.push_back(lt);
+		p.stripLT();
+	}
+	Polynomial res(std::move(remainder), false, false);
+	if(Polynomial::Policy::has_reasons) res.setReasons(reasons);
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+void F5C<Polynomial, AddingPolicy>::interreduce(std::vector<Polynomial>& basis)
+{
+	std::sort(basis.begin(), basis.end(), Polynomial::compareByLeadingTerm);
+	std::vector<Polynomial> minimal;
+	for(const Polynomial& g : basis)
+	{
+		bool redundant = std::any_of(minimal.begin(), minimal.end(), [&g](const Polynomial& h){ return divides(h.lmon(), g.lmon()); });
+		if(!redundant) minimal.push_back(g);
+	}
+	basis.clear();
+	for(std::size_t i = 0; i < minimal.size(); ++i)
+	{
+		Ideal<Polynomial> others;
+		for(std::size_t j = 0; j < minimal.size(); ++j)
+		{
+			if(j != i) others.addGenerator(minimal[j]);
+		}
+		basis.push_back(normalize(Reductor<Polynomial, Polynomial>(others, minimal[i]).fullReduce()));
+	}
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Polynomial F5C<Polynomial, AddingPolicy>::normalize(const Polynomial& p)
+{
+	Polynomial res = p.normalize();
+	if(Polynomial::Policy::has_reasons) res.setReasons(p.getReasons());
+	return res;
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+bool F5C<Polynomial, AddingPolicy>::divides(const Monomial::Arg& d, const Monomial::Arg& m)
+{
+	if(!m) return !d;
+	return m->divisible(d);
+}
+
+template<class Polynomial, template<typename> class AddingPolicy>
+Monomial::Arg F5C<Polynomial, AddingPolicy>::quotient(const Monomial::Arg& m, const Monomial::Arg& d)
+{
+	if(!d) return m;
+	Monomial::Arg res;
+	bool divided = m->divide(d, res);
+	assert(divided);
+	(void)divided;
+	return res;
+}
+
+}
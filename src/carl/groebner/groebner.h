@@ -9,4 +9,7 @@
 
 #include "GBProcedure.h"
 #include "gb-buchberger/Buchberger.h"
+#include "gb-f4/F4.h"
+#include "gb-modular/Modular.h"
+#include "gb-signature/F5C.h"
 #include "Reductor.h"
\ No newline at end of file
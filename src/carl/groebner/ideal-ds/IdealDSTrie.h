@@ -0,0 +1,234 @@
+/**
+ * @file:   IdealDSTrie.h
+ *
+ * Divisor lookup using divisibility masks and a trie over exponent vectors.
+ */
+
+#pragma once
+
+#include "../../core/Term.h"
+#include "../../core/Variable.h"
+#include "../DivisionLookupResult.h"
+#include "PolynomialSorts.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace carl
+{
+
+/**
+ * Divisor lookup which stores the leading monomials of the generators in a trie.
+ *
+ * Every level of the trie corresponds to one variable occurring in some leading monomial,
+ * the children of a node are the different exponents of this variable.
+ * Looking for the divisors of a term only descends into children whose exponent is at most the exponent in the term.
+ * Additionally, every monomial is mapped to a divisibility mask, where the bits of a variable are set according to its exponent,
+ * such that a monomial can only divide another one if its bits are a subset of the bits of the other one.
+ * Every node stores the bits common to all monomials below, hence whole subtrees are rejected by a single AND.
+ *
+ * As for IdealDatastructureVector, the divisor with the smallest leading term is returned.
+ * @ingroup gb
+ */
+template<class Polynomial>
+class IdealDatastructureTrie
+{
+public:
+	using Mask = std::uint64_t;
+
+	/// Statistics about the divisor lookups.
+	struct Statistics {
+		/// Number of calls to getDivisor.
+		std::size_t lookups = 0;
+		/// Number of generators which were rejected by the divisibility masks.
+		std::size_t rejected = 0;
+		/// Number of generators which were reached in the trie, i.e. whose exponents were compared.
+		std::size_t tested = 0;
+	};
+
+	IdealDatastructureTrie(const std::vector<Polynomial>& generators, const std::unordered_set<size_t>& eliminated, const sortByLeadingTerm<Polynomial>& order)
+	: mGenerators(generators), mEliminated(eliminated), mOrder(order)
+	{
+		reset();
+	}
+
+	IdealDatastructureTrie(const IdealDatastructureTrie& id)
+	: mGenerators(id.mGenerators), mEliminated(id.mEliminated), mOrder(id.mOrder), mStatistics(id.mStatistics)
+	{
+		reset();
+	}
+
+	virtual ~IdealDatastructureTrie() = default;
+
+	/**
+	 * Should be called whenever an generator is added
+	 * @param fIndex
+	 */
+	void addGenerator(size_t fIndex)
+	{
+		assert(fIndex < mGenerators.size());
+		const Monomial::Arg& lmon = mGenerators[fIndex].lmon();
+		if (lmon) {
+			for (const auto& ve: lmon->exponents()) {
+				if (!std::binary_search(mVariables.begin(), mVariables.end(), ve.first)) {
+					// The levels of the trie change, hence it is rebuilt.
+					reset();
+					return;
+				}
+			}
+		}
+		insert(fIndex);
+	}
+
+	/**
+	 * @param t
+	 * @return A divisionresult [divisor, factor].
+	 */
+	DivisionLookupResult<Polynomial> getDivisor(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		++mStatistics.lookups;
+		std::vector<exponent> exponents = exponentVector(t.monomial());
+		std::size_t best = mGenerators.size();
+		lookup(mRoot, 0, exponents, divmask(exponents), best);
+		if (best == mGenerators.size()) return DivisionLookupResult<Polynomial>();
+
+		Term<typename Polynomial::CoeffType> divres;
+		bool divided = t.divide(mGenerators[best].lterm(), divres);
+		assert(divided);
+		(void)divided;
+		//To eliminate, we have to negate the factor.
+		divres.negate();
+		return DivisionLookupResult<Polynomial>(&mGenerators[best], divres);
+	}
+
+	bool isDividable(const Term<typename Polynomial::CoeffType>& t) const
+	{
+		return getDivisor(t).success();
+	}
+
+	/**
+	 * Should be called if the generator set is reset.
+	 */
+	void reset()
+	{
+		mVariables.clear();
+		for (const auto& g: mGenerators) {
+			if (!g.lmon()) continue;
+			for (const auto& ve: g.lmon()->exponents()) mVariables.push_back(ve.first);
+		}
+		std::sort(mVariables.begin(), mVariables.end());
+		mVariables.erase(std::unique(mVariables.begin(), mVariables.end()), mVariables.end());
+		mRoot = Node();
+		for (std::size_t i = 0; i < mGenerators.size(); ++i) {
+			if (mEliminated.count(i) == 0) insert(i);
+		}
+	}
+
+	const Statistics& statistics() const
+	{
+		return mStatistics;
+	}
+
+private:
+	struct Node {
+		/// Bits which are set in the masks of all generators below this node.
+		Mask mask = ~Mask(0);
+		/// Number of generators below this node.
+		std::size_t size = 0;
+		/// Children by exponent, sorted by exponent.
+		std::vector<std::pair<exponent, std::unique_ptr<Node>>> children;
+		/// Generators whose leading monomial ends in this node, only used in leaves.
+		std::vector<std::size_t> generators;
+	};
+
+	/// A reference to the generators in the ideal
+	const std::vector<Polynomial>& mGenerators;
+	/// A reference to the indices of eliminated generators
+	const std::unordered_set<size_t>& mEliminated;
+	/// A object which orders the generators according their leading terms, given their indices
+	const sortByLeadingTerm<Polynomial>& mOrder;
+	/// The variables of the leading monomials, one for every level of the trie.
+	std::vector<Variable> mVariables;
+	Node mRoot;
+	mutable Statistics mStatistics;
+
+	/// Exponents of the given monomial for the variables in mVariables.
+	std::vector<exponent> exponentVector(const Monomial::Arg& m) const
+	{
+		std::vector<exponent> res(mVariables.size(), 0);
+		if (!m) return res;
+		auto var = mVariables.begin();
+		for (const auto& ve: m->exponents()) {
+			var = std::lower_bound(var, mVariables.end(), ve.first);
+			if (var == mVariables.end()) break;
+			if (*var == ve.first) res[std::size_t(var - mVariables.begin())] = ve.second;
+		}
+		return res;
+	}
+
+	/**
+	 * Every variable gets the same number of bits, bit j of a variable is set if its exponent is larger than j.
+	 * If there are more variables than bits, the bits are shared by multiple variables.
+	 */
+	Mask divmask(const std::vector<exponent>& exponents) const
+	{
+		constexpr std::size_t bits = sizeof(Mask) * 8;
+		std::size_t perVariable = std::max(bits / std::max(exponents.size(), std::size_t(1)), std::size_t(1));
+		Mask res = 0;
+		for (std::size_t i = 0; i < exponents.size(); ++i) {
+			for (std::size_t j = 0; j < perVariable && j < exponents[i]; ++j) {
+				res |= Mask(1) << ((i * perVariable + j) % bits);
+			}
+		}
+		return res;
+	}
+
+	void insert(std::size_t index)
+	{
+		std::vector<exponent> exponents = exponentVector(mGenerators[index].lmon());
+		Mask mask = divmask(exponents);
+		Node* node = &mRoot;
+		for (exponent e: exponents) {
+			node->mask &= mask;
+			++node->size;
+			auto it = std::lower_bound(node->children.begin(), node->children.end(), e,
+				[](const std::pair<exponent, std::unique_ptr<Node>>& child, exponent exp){ return child.first < exp; }
+			);
+			if (it == node->children.end() || it->first != e) {
+				it = node->children.emplace(it, e, std::unique_ptr<Node>(new Node()));
+			}
+			node = it->second.get();
+		}
+		node->mask &= mask;
+		++node->size;
+		node->generators.push_back(index);
+	}
+
+	/// Searches the divisors below the node and stores the smallest one in best.
+	void lookup(const Node& node, std::size_t level, const std::vector<exponent>& exponents, Mask mask, std::size_t& best) const
+	{
+		if ((node.mask & ~mask) != 0) {
+			mStatistics.rejected += node.size;
+			return;
+		}
+		if (level == exponents.size()) {
+			for (std::size_t index: node.generators) {
+				++mStatistics.tested;
+				if (mEliminated.count(index) == 1) continue;
+				if (best == mGenerators.size() || mOrder(index, best)) best = index;
+			}
+			return;
+		}
+		for (const auto& child: node.children) {
+			if (child.first > exponents[level]) break;
+			lookup(*child.second, level + 1, exponents, mask, best);
+		}
+	}
+};
+
+}
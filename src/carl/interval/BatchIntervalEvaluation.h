@@ -0,0 +1,381 @@
+/**
+ * @file BatchIntervalEvaluation.h
+ *
+ * Interval evaluation of a single polynomial over many boxes at once.
+ *
+ * The polynomial (or a MultivariateHorner scheme) is compiled once into a straight-line program.
+ * The boxes are stored as a structure of arrays, i.e. for every variable one array of lower and one array of upper bounds.
+ * The program is executed on blocks of boxes, where every instruction is a simple loop over the lower and upper bounds.
+ * These loops do not branch and are vectorized by the compiler.
+ *
+ * Outward rounding is done without switching the rounding mode:
+ * results are computed with the default rounding to nearest and moved outwards by a relative error of 2^-51 plus the smallest subnormal number.
+ * This is at least one ulp and thus yields a valid enclosure.
+ *
+ * All powers of variables that occur in the polynomial are computed once per box and shared between all terms.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "NativeInterval.h"
+#include "../core/MultivariatePolynomial.h"
+#include "../core/Term.h"
+#include "../core/Variable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace carl {
+
+template<typename PolynomialType, class strategy>
+class MultivariateHorner;
+
+/**
+ * A set of boxes stored as structure of arrays.
+ * All boxes assign an interval to each of the variables given upon construction.
+ */
+class IntervalBoxes {
+private:
+	std::vector<Variable> mVariables;
+	std::vector<std::vector<double>> mLower;
+	std::vector<std::vector<double>> mUpper;
+	std::size_t mSize = 0;
+public:
+	explicit IntervalBoxes(const std::vector<Variable>& variables):
+		mVariables(variables),
+		mLower(variables.size()),
+		mUpper(variables.size())
+	{}
+
+	/// Returns the number of boxes.
+	std::size_t size() const {
+		return mSize;
+	}
+	/// Returns the number of variables.
+	std::size_t dimension() const {
+		return mVariables.size();
+	}
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	/// Returns the index of the given variable.
+	std::size_t indexOf(Variable v) const {
+		auto it = std::find(mVariables.begin(), mVariables.end(), v);
+		assert(it != mVariables.end());
+		return std::size_t(std::distance(mVariables.begin(), it));
+	}
+	void reserve(std::size_t n) {
+		for (std::size_t v = 0; v < dimension(); v++) {
+			mLower[v].reserve(n);
+			mUpper[v].reserve(n);
+		}
+	}
+	void clear() {
+		for (std::size_t v = 0; v < dimension(); v++) {
+			mLower[v].clear();
+			mUpper[v].clear();
+		}
+		mSize = 0;
+	}
+
+	/// Adds a box and returns its index. Every variable is expected to be in the map.
+	std::size_t add(const std::map<Variable, NativeInterval>& box) {
+		for (std::size_t v = 0; v < dimension(); v++) {
+			assert(box.find(mVariables[v]) != box.end());
+			const auto& i = box.at(mVariables[v]);
+			mLower[v].push_back(i.lower());
+			mUpper[v].push_back(i.upper());
+		}
+		return mSize++;
+	}
+	/// Adds a box and returns its index. Every variable is expected to be in the map.
+	std::size_t add(const std::map<Variable, Interval<double>>& box) {
+		for (std::size_t v = 0; v < dimension(); v++) {
+			assert(box.find(mVariables[v]) != box.end());
+			NativeInterval i(box.at(mVariables[v]));
+			mLower[v].push_back(i.lower());
+			mUpper[v].push_back(i.upper());
+		}
+		return mSize++;
+	}
+
+	NativeInterval get(std::size_t box, std::size_t variable) const {
+		assert(box < size() && variable < dimension());
+		return NativeInterval(mLower[variable][box], mUpper[variable][box]);
+	}
+	void set(std::size_t box, std::size_t variable, const NativeInterval& i) {
+		assert(box < size() && variable < dimension());
+		mLower[variable][box] = i.lower();
+		mUpper[variable][box] = i.upper();
+	}
+	/// Returns the lower bounds of the given variable for all boxes.
+	const double* lower(std::size_t variable) const {
+		return mLower[variable].data();
+	}
+	/// Returns the upper bounds of the given variable for all boxes.
+	const double* upper(std::size_t variable) const {
+		return mUpper[variable].data();
+	}
+};
+
+/**
+ * A polynomial compiled for the interval evaluation over many boxes.
+ * Evaluating over unbounded boxes is possible but may yield an unbounded result even if the exact range is bounded.
+ */
+class BatchIntervalEvaluation {
+public:
+	/// Number of boxes that are processed at once.
+	static constexpr std::size_t blockSize = 256;
+private:
+	enum class Opcode {
+		Constant, Add, Mul, AddConstant, MulConstant
+	};
+	/// target = lhs op rhs, or target = lhs op constant.
+	struct Instruction {
+		Opcode op;
+		std::size_t target;
+		std::size_t lhs;
+		std::size_t rhs;
+		NativeInterval constant;
+	};
+	/// A power of a variable, stored in its own register.
+	struct Power {
+		Variable variable;
+		uint exponent;
+		std::size_t reg;
+	};
+
+	std::vector<Power> mPowers;
+	std::vector<Instruction> mInstructions;
+	std::size_t mRegisters = 0;
+	std::vector<std::size_t> mFreeRegisters;
+	std::size_t mResult = 0;
+
+	static constexpr double relativeError() {
+		return 2 * std::numeric_limits<double>::epsilon();
+	}
+	static double roundDown(double d) {
+		return d - (std::abs(d) * relativeError() + std::numeric_limits<double>::denorm_min());
+	}
+	static double roundUp(double d) {
+		return d + (std::abs(d) * relativeError() + std::numeric_limits<double>::denorm_min());
+	}
+
+	template<typename Coeff>
+	static NativeInterval enclose(const Coeff& c) {
+		if (carl::isZero(c)) return NativeInterval(0);
+		double d = carl::toDouble(c);
+		return NativeInterval(native_interval::nextDown(d), native_interval::nextUp(d));
+	}
+
+	bool isPower(std::size_t reg) const {
+		return std::any_of(mPowers.begin(), mPowers.end(), [reg](const Power& p){ return p.reg == reg; });
+	}
+	std::size_t allocate() {
+		if (mFreeRegisters.empty()) return mRegisters++;
+		std::size_t res = mFreeRegisters.back();
+		mFreeRegisters.pop_back();
+		return res;
+	}
+	void release(std::size_t reg) {
+		if (!isPower(reg)) mFreeRegisters.push_back(reg);
+	}
+	/// Returns the register holding v^exp.
+	std::size_t power(Variable v, uint exp) {
+		for (const auto& p: mPowers) {
+			if (p.variable == v && p.exponent == exp) return p.reg;
+		}
+		mPowers.push_back(Power{ v, exp, mRegisters++ });
+		return mPowers.back().reg;
+	}
+	/// Returns a fresh register that holds lhs op rhs.
+	std::size_t emit(Opcode op, std::size_t lhs, std::size_t rhs, const NativeInterval& constant = NativeInterval()) {
+		std::size_t target = isPower(lhs) ? allocate() : lhs;
+		mInstructions.push_back(Instruction{ op, target, lhs, rhs, constant });
+		if (rhs != lhs && (op == Opcode::Add || op == Opcode::Mul)) release(rhs);
+		return target;
+	}
+	std::size_t constant(const NativeInterval& c) {
+		std::size_t target = allocate();
+		mInstructions.push_back(Instruction{ Opcode::Constant, target, target, target, c });
+		return target;
+	}
+
+	template<typename C, typename O, typename P>
+	void compile(const MultivariatePolynomial<C,O,P>& p) {
+		bool hasResult = false;
+		NativeInterval constantPart;
+		for (const auto& t: p) {
+			if (!t.monomial()) {
+				constantPart += enclose(t.coeff());
+				continue;
+			}
+			const auto& m = *t.monomial();
+			std::size_t reg = power(m[0].first, uint(m[0].second));
+			for (std::size_t i = 1; i < m.nrVariables(); i++) {
+				reg = emit(Opcode::Mul, reg, power(m[i].first, uint(m[i].second)));
+			}
+			if (!carl::isOne(t.coeff())) {
+				reg = emit(Opcode::MulConstant, reg, reg, enclose(t.coeff()));
+			}
+			if (hasResult) {
+				mResult = emit(Opcode::Add, mResult, reg);
+			} else {
+				mResult = reg;
+				hasResult = true;
+			}
+		}
+		if (!hasResult) {
+			mResult = constant(constantPart);
+		} else if (!constantPart.isZero()) {
+			mResult = emit(Opcode::AddConstant, mResult, mResult, constantPart);
+		}
+	}
+
+	/// Compiles h = variable^exponent * dependent + independent.
+	template<typename PolynomialType, class Strategy>
+	std::size_t compile(const MultivariateHorner<PolynomialType, Strategy>& h) {
+		if (h.getVariable() == Variable::NO_VARIABLE) {
+			return constant(enclose(h.getIndepConstant()));
+		}
+		std::size_t reg = power(h.getVariable(), h.getExponent());
+		if (h.getDependent()) {
+			reg = emit(Opcode::Mul, compile(*h.getDependent()), reg);
+		} else if (!carl::isOne(h.getDepConstant())) {
+			reg = emit(Opcode::MulConstant, reg, reg, enclose(h.getDepConstant()));
+		}
+		if (h.getIndependent()) {
+			reg = emit(Opcode::Add, reg, compile(*h.getIndependent()));
+		} else if (!carl::isZero(h.getIndepConstant())) {
+			reg = emit(Opcode::AddConstant, reg, reg, enclose(h.getIndepConstant()));
+		}
+		return reg;
+	}
+
+	static void mul(std::size_t n, const double* al, const double* au, const double* bl, const double* bu, double* rl, double* ru) {
+		for (std::size_t i = 0; i < n; i++) {
+			double ll = al[i] * bl[i];
+			double lu = al[i] * bu[i];
+			double ul = au[i] * bl[i];
+			double uu = au[i] * bu[i];
+			rl[i] = roundDown(std::min(std::min(ll, lu), std::min(ul, uu)));
+			ru[i] = roundUp(std::max(std::max(ll, lu), std::max(ul, uu)));
+		}
+	}
+	static void mulConstant(std::size_t n, const double* al, const double* au, const NativeInterval& c, double* rl, double* ru) {
+		double cl = c.lower();
+		double cu = c.upper();
+		for (std::size_t i = 0; i < n; i++) {
+			double ll = al[i] * cl;
+			double lu = al[i] * cu;
+			double ul = au[i] * cl;
+			double uu = au[i] * cu;
+			rl[i] = roundDown(std::min(std::min(ll, lu), std::min(ul, uu)));
+			ru[i] = roundUp(std::max(std::max(ll, lu), std::max(ul, uu)));
+		}
+	}
+public:
+	/// Compiles a polynomial.
+	template<typename C, typename O, typename P>
+	explicit BatchIntervalEvaluation(const MultivariatePolynomial<C,O,P>& p) {
+		compile(p);
+	}
+	/// Compiles a Horner scheme, preserving its structure.
+	template<typename PolynomialType, class Strategy>
+	explicit BatchIntervalEvaluation(const MultivariateHorner<PolynomialType, Strategy>& h) {
+		mResult = compile(h);
+	}
+
+	/// Returns the number of instructions, not counting the computation of the powers.
+	std::size_t size() const {
+		return mInstructions.size();
+	}
+	/// Returns the number of registers, each holding one interval per box of a block.
+	std::size_t registers() const {
+		return mRegisters;
+	}
+
+	/**
+	 * Evaluates the polynomial over all given boxes.
+	 * @param boxes Boxes, must assign all variables of the polynomial.
+	 * @return An enclosure of the range of the polynomial for every box.
+	 */
+	std::vector<NativeInterval> evaluate(const IntervalBoxes& boxes) const {
+		std::vector<NativeInterval> result(boxes.size());
+		std::vector<std::size_t> variables;
+		for (const auto& p: mPowers) variables.push_back(boxes.indexOf(p.variable));
+		std::vector<double> lower(mRegisters * blockSize);
+		std::vector<double> upper(mRegisters * blockSize);
+		auto lo = [&lower](std::size_t reg){ return lower.data() + reg * blockSize; };
+		auto up = [&upper](std::size_t reg){ return upper.data() + reg * blockSize; };
+
+		for (std::size_t start = 0; start < boxes.size(); start += blockSize) {
+			std::size_t n = std::min(std::size_t(blockSize), boxes.size() - start);
+			for (std::size_t k = 0; k < mPowers.size(); k++) {
+				const double* bl = boxes.lower(variables[k]) + start;
+				const double* bu = boxes.upper(variables[k]) + start;
+				double* rl = lo(mPowers[k].reg);
+				double* ru = up(mPowers[k].reg);
+				if (mPowers[k].exponent == 1) {
+					std::copy(bl, bl + n, rl);
+					std::copy(bu, bu + n, ru);
+					continue;
+				}
+				for (std::size_t i = 0; i < n; i++) {
+					auto res = NativeInterval(bl[i], bu[i]).pow(mPowers[k].exponent);
+					rl[i] = res.lower();
+					ru[i] = res.upper();
+				}
+			}
+			for (const auto& instr: mInstructions) {
+				double* rl = lo(instr.target);
+				double* ru = up(instr.target);
+				const double* al = lo(instr.lhs);
+				const double* au = up(instr.lhs);
+				const double* bl = lo(instr.rhs);
+				const double* bu = up(instr.rhs);
+				switch (instr.op) {
+					case Opcode::Constant:
+						std::fill(rl, rl + n, instr.constant.lower());
+						std::fill(ru, ru + n, instr.constant.upper());
+						break;
+					case Opcode::Add:
+						for (std::size_t i = 0; i < n; i++) {
+							rl[i] = roundDown(al[i] + bl[i]);
+							ru[i] = roundUp(au[i] + bu[i]);
+						}
+						break;
+					case Opcode::AddConstant: {
+						double cl = instr.constant.lower();
+						double cu = instr.constant.upper();
+						for (std::size_t i = 0; i < n; i++) {
+							rl[i] = roundDown(al[i] + cl);
+							ru[i] = roundUp(au[i] + cu);
+						}
+						break;
+					}
+					case Opcode::Mul:
+						mul(n, al, au, bl, bu, rl, ru);
+						break;
+					case Opcode::MulConstant:
+						mulConstant(n, al, au, instr.constant, rl, ru);
+						break;
+				}
+			}
+			const double* rl = lo(mResult);
+			const double* ru = up(mResult);
+			for (std::size_t i = 0; i < n; i++) {
+				// NaN stems from products of zero and infinity or sums of infinities with different signs.
+				if (std::isnan(rl[i]) || std::isnan(ru[i])) result[start + i] = NativeInterval::unboundedInterval();
+				else result[start + i] = NativeInterval(rl[i], ru[i]);
+			}
+		}
+		return result;
+	}
+};
+
+}
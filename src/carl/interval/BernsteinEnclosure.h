@@ -0,0 +1,224 @@
+/**
+ * @file BernsteinEnclosure.h
+ *
+ * Range enclosure of multivariate polynomials over boxes using the Bernstein basis.
+ *
+ * The polynomial is transformed to the unit box and expanded in the tensor product Bernstein basis.
+ * The range of the polynomial over the box is enclosed by the minimum and maximum Bernstein coefficient.
+ * Moreover, the Bernstein coefficients at the vertices of the coefficient array coincide with the values of the polynomial at the vertices of the box.
+ * Hence, if the minimum (maximum) is attained at such a coefficient, the lower (upper) bound is exact.
+ *
+ * Subdividing the box in some variable yields the Bernstein coefficients of both halves by de Casteljau's algorithm from the coefficients of the parent.
+ * All computations are exact, which allows for exact sign decisions.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "../core/Sign.h"
+#include "../core/Variable.h"
+
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+template<typename Poly>
+class BernsteinEnclosure {
+public:
+	using Coeff = typename Poly::CoeffType;
+private:
+	/// The variables, which determine the dimensions of the coefficient array.
+	std::vector<Variable> mVariables;
+	/// The degree of the polynomial in each variable.
+	std::vector<std::size_t> mDegrees;
+	/// Offset of the next coefficient in each dimension within mCoefficients.
+	std::vector<std::size_t> mStrides;
+	/// The box, aligned with mVariables.
+	std::vector<Interval<Coeff>> mBox;
+	/// The Bernstein coefficients, stored as a dense array in row-major order.
+	std::vector<Coeff> mCoefficients;
+
+	void initStrides() {
+		mStrides.assign(mVariables.size(), 1);
+		std::size_t size = 1;
+		for (std::size_t d = mVariables.size(); d > 0; d--) {
+			mStrides[d-1] = size;
+			size *= mDegrees[d-1] + 1;
+		}
+		mCoefficients.assign(size, Coeff(0));
+	}
+
+	/**
+	 * Calls f(offset) with the offset of the first element of every fiber along the given dimension.
+	 */
+	template<typename F>
+	void forEachFiber(std::size_t dim, F&& f) const {
+		std::size_t outer = mStrides[dim] * (mDegrees[dim] + 1);
+		for (std::size_t block = 0; block < mCoefficients.size(); block += outer) {
+			for (std::size_t inner = 0; inner < mStrides[dim]; inner++) {
+				f(block + inner);
+			}
+		}
+	}
+
+	/// Converts the coefficients of the power basis to the Bernstein basis along the given dimension.
+	void toBernstein(std::size_t dim) {
+		std::size_t n = mDegrees[dim];
+		if (n == 0) return;
+		// binomial[j][k] = j choose k
+		std::vector<std::vector<Coeff>> binomial(n + 1);
+		for (std::size_t j = 0; j <= n; j++) {
+			binomial[j].assign(j + 1, Coeff(1));
+			for (std::size_t k = 1; k < j; k++) binomial[j][k] = binomial[j-1][k-1] + binomial[j-1][k];
+		}
+		std::vector<Coeff> power(n + 1);
+		forEachFiber(dim, [&](std::size_t offset){
+			for (std::size_t k = 0; k <= n; k++) power[k] = mCoefficients[offset + k * mStrides[dim]];
+			for (std::size_t j = 0; j <= n; j++) {
+				Coeff sum(0);
+				for (std::size_t k = 0; k <= j; k++) {
+					sum += binomial[j][k] / binomial[n][k] * power[k];
+				}
+				mCoefficients[offset + j * mStrides[dim]] = sum;
+			}
+		});
+	}
+
+	/// Checks whether the given index is a vertex of the coefficient array.
+	bool isVertex(std::size_t index) const {
+		for (std::size_t d = 0; d < mVariables.size(); d++) {
+			std::size_t i = (index / mStrides[d]) % (mDegrees[d] + 1);
+			if (i != 0 && i != mDegrees[d]) return false;
+		}
+		return true;
+	}
+public:
+	/**
+	 * Computes the Bernstein coefficients of the polynomial over the given box.
+	 * @param p Polynomial.
+	 * @param box Bounded intervals for all variables of p.
+	 */
+	BernsteinEnclosure(const Poly& p, const std::map<Variable, Interval<Coeff>>& box) {
+		Poly q = p;
+		for (auto v: p.gatherVariables()) {
+			const Interval<Coeff>& i = box.at(v);
+			assert(!i.isEmpty() && !i.isUnbounded());
+			mVariables.push_back(v);
+			mBox.push_back(i);
+			// Transform x = lower + (upper - lower) * t for t in [0,1].
+			q = q.substitute(v, Poly(i.lower()) + Poly(i.upper() - i.lower()) * v);
+		}
+		for (auto v: mVariables) mDegrees.push_back(q.degree(v));
+		initStrides();
+		for (const auto& term: q) {
+			std::size_t index = 0;
+			if (term.monomial()) {
+				for (std::size_t d = 0; d < mVariables.size(); d++) {
+					index += term.monomial()->exponentOfVariable(mVariables[d]) * mStrides[d];
+				}
+			}
+			mCoefficients[index] += term.coeff();
+		}
+		for (std::size_t d = 0; d < mVariables.size(); d++) toBernstein(d);
+	}
+
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+	const std::vector<Coeff>& coefficients() const {
+		return mCoefficients;
+	}
+	/// Returns the interval of the given variable.
+	const Interval<Coeff>& interval(Variable::Arg v) const {
+		auto it = std::find(mVariables.begin(), mVariables.end(), v);
+		assert(it != mVariables.end());
+		return mBox[std::size_t(it - mVariables.begin())];
+	}
+
+	/// Returns the enclosure of the range of the polynomial over the box.
+	Interval<Coeff> range() const {
+		auto minmax = std::minmax_element(mCoefficients.begin(), mCoefficients.end());
+		return Interval<Coeff>(*minmax.first, BoundType::WEAK, *minmax.second, BoundType::WEAK);
+	}
+	/// Checks whether the lower bound of range() is attained by the polynomial, i.e. the minimum coefficient is at a vertex.
+	bool isLowerBoundTight() const {
+		auto min = *std::min_element(mCoefficients.begin(), mCoefficients.end());
+		for (std::size_t i = 0; i < mCoefficients.size(); i++) {
+			if (mCoefficients[i] == min && isVertex(i)) return true;
+		}
+		return false;
+	}
+	/// Checks whether the upper bound of range() is attained by the polynomial, i.e. the maximum coefficient is at a vertex.
+	bool isUpperBoundTight() const {
+		auto max = *std::max_element(mCoefficients.begin(), mCoefficients.end());
+		for (std::size_t i = 0; i < mCoefficients.size(); i++) {
+			if (mCoefficients[i] == max && isVertex(i)) return true;
+		}
+		return false;
+	}
+	/// Checks whether range() is the exact range of the polynomial over the box.
+	bool isTight() const {
+		return isLowerBoundTight() && isUpperBoundTight();
+	}
+
+	/**
+	 * Returns the sign of the polynomial on the box, if it is the same everywhere.
+	 * Otherwise, or if the enclosure is too coarse to decide this, boost::none is returned.
+	 */
+	boost::optional<Sign> sign() const {
+		auto r = range();
+		if (r.lower() > 0) return Sign::POSITIVE;
+		if (r.upper() < 0) return Sign::NEGATIVE;
+		if (r.isZero()) return Sign::ZERO;
+		return boost::none;
+	}
+
+	/// Returns the variable whose interval is the widest among those the polynomial depends on.
+	Variable widestVariable() const {
+		std::size_t best = 0;
+		for (std::size_t d = 1; d < mVariables.size(); d++) {
+			if (mDegrees[best] == 0 || (mDegrees[d] > 0 && mBox[d].diameter() > mBox[best].diameter())) best = d;
+		}
+		return mVariables.empty() ? Variable::NO_VARIABLE : mVariables[best];
+	}
+
+	/**
+	 * Bisects the box in the given variable.
+	 * The coefficients of both halves are obtained by de Casteljau's algorithm from the coefficients of this box.
+	 * @param v Variable to split.
+	 * @return Enclosures for the lower and the upper half.
+	 */
+	std::pair<BernsteinEnclosure,BernsteinEnclosure> split(Variable::Arg v) const {
+		std::size_t dim = std::size_t(std::find(mVariables.begin(), mVariables.end(), v) - mVariables.begin());
+		assert(dim < mVariables.size());
+		BernsteinEnclosure lower(*this);
+		BernsteinEnclosure upper(*this);
+		Coeff center = mBox[dim].center();
+		lower.mBox[dim] = Interval<Coeff>(mBox[dim].lower(), BoundType::WEAK, center, BoundType::WEAK);
+		upper.mBox[dim] = Interval<Coeff>(center, BoundType::WEAK, mBox[dim].upper(), BoundType::WEAK);
+		std::size_t n = mDegrees[dim];
+		std::size_t stride = mStrides[dim];
+		std::vector<Coeff> tmp(n + 1);
+		forEachFiber(dim, [&](std::size_t offset){
+			for (std::size_t k = 0; k <= n; k++) tmp[k] = mCoefficients[offset + k * stride];
+			lower.mCoefficients[offset] = tmp[0];
+			upper.mCoefficients[offset + n * stride] = tmp[n];
+			for (std::size_t r = 1; r <= n; r++) {
+				for (std::size_t k = 0; k + r <= n; k++) {
+					tmp[k] = (tmp[k] + tmp[k+1]) / 2;
+				}
+				lower.mCoefficients[offset + r * stride] = tmp[0];
+				upper.mCoefficients[offset + (n - r) * stride] = tmp[n - r];
+			}
+		});
+		return std::make_pair(std::move(lower), std::move(upper));
+	}
+};
+
+}
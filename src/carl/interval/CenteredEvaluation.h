@@ -0,0 +1,164 @@
+/**
+ * @file CenteredEvaluation.h
+ *
+ * Evaluation of a polynomial over a box using forms that are centered at the midpoint of the box.
+ *
+ * The natural interval evaluation of a polynomial overestimates its range by an amount proportional to the width of the box.
+ * Centered forms reduce this to a quadratic (mean value, centered form) or even cubic (second order Taylor) dependency for narrow boxes.
+ * All forms need the partial derivatives of the polynomial, which are computed once and cached.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "IntervalEvaluation.h"
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * The different forms to evaluate a polynomial over a box, where x is the box and c its center:
+ * - Natural: the polynomial is evaluated term by term.
+ * - MeanValue: f(c) + sum_i df/dx_i(x) * (x_i - c_i)
+ * - Centered: the polynomial is expanded at c, i.e. f(c + y) is evaluated naturally for y = x - c.
+ * - Taylor: f(c) + sum_i df/dx_i(c) * (x_i - c_i) + 1/2 * sum_i,j d^2f/dx_i dx_j(x) * (x_i - c_i) * (x_j - c_j)
+ */
+enum class IntervalEvaluationForm { Natural, MeanValue, Centered, Taylor };
+
+inline std::ostream& operator<<(std::ostream& os, IntervalEvaluationForm form) {
+	switch (form) {
+		case IntervalEvaluationForm::Natural: return os << "Natural";
+		case IntervalEvaluationForm::MeanValue: return os << "MeanValue";
+		case IntervalEvaluationForm::Centered: return os << "Centered";
+		case IntervalEvaluationForm::Taylor: return os << "Taylor";
+	}
+	return os << "Unknown";
+}
+
+/**
+ * Evaluates a fixed polynomial over boxes in any IntervalEvaluationForm.
+ * The first and second order partial derivatives are computed on demand and cached.
+ * Every variable of the polynomial must be assigned a bounded interval, otherwise the natural form is used.
+ */
+template<typename Polynomial>
+class CenteredEvaluation {
+private:
+	using Coeff = typename Polynomial::CoeffType;
+
+	Polynomial mPolynomial;
+	std::vector<Variable> mVariables;
+	/// First order partial derivatives.
+	std::map<Variable, Polynomial> mDerivatives;
+	/// Second order partial derivatives, indexed by ordered pairs of variables.
+	std::map<std::pair<Variable,Variable>, Polynomial> mSecondDerivatives;
+	/// The center of the current box, reused among calls.
+	IntervalBox<double> mCenter;
+	/// The current box shifted by its center, reused among calls.
+	IntervalBox<double> mDelta;
+
+	/// Computes center and shifted box, returns false if some interval is empty or unbounded.
+	template<typename Map>
+	bool setCenter(const Map& box) {
+		for (auto v: mVariables) {
+			const Interval<double>& i = box.at(v);
+			if (i.isEmpty() || i.isUnbounded()) return false;
+			Interval<double> center(i.center());
+			mCenter.set(v, center);
+			mDelta.set(v, i.sub(center));
+		}
+		return true;
+	}
+
+	template<typename Map>
+	Interval<double> meanValue(const Map& box) {
+		Interval<double> result = IntervalEvaluation::evaluate(mPolynomial, mCenter);
+		for (auto v: mVariables) {
+			result += IntervalEvaluation::evaluate(derivative(v), box) * mDelta.at(v);
+		}
+		return result;
+	}
+
+	Interval<double> centered() {
+		Polynomial shifted = mPolynomial;
+		for (auto v: mVariables) {
+			shifted = shifted.substitute(v, Polynomial(v) + carl::rationalize<Coeff>(mCenter.at(v).lower()));
+		}
+		return IntervalEvaluation::evaluate(shifted, mDelta);
+	}
+
+	template<typename Map>
+	Interval<double> taylor(const Map& box) {
+		Interval<double> result = IntervalEvaluation::evaluate(mPolynomial, mCenter);
+		Interval<double> quadratic(0);
+		for (std::size_t i = 0; i < mVariables.size(); i++) {
+			Variable vi = mVariables[i];
+			const Interval<double>& di = mDelta.at(vi);
+			result += IntervalEvaluation::evaluate(derivative(vi), mCenter) * di;
+			quadratic += IntervalEvaluation::evaluate(derivative(vi, vi), box) * di.pow(2);
+			for (std::size_t j = i + 1; j < mVariables.size(); j++) {
+				Variable vj = mVariables[j];
+				// The mixed derivatives occur twice in the sum, which cancels with the factor 1/2.
+				quadratic += IntervalEvaluation::evaluate(derivative(vi, vj), box) * di * mDelta.at(vj) * Interval<double>(2);
+			}
+		}
+		return result + quadratic * Interval<double>(0.5);
+	}
+public:
+	explicit CenteredEvaluation(const Polynomial& p):
+		mPolynomial(p)
+	{
+		auto vars = p.gatherVariables();
+		mVariables.assign(vars.begin(), vars.end());
+		for (auto v: mVariables) {
+			mCenter.reserve(v);
+			mDelta.reserve(v);
+		}
+	}
+
+	const Polynomial& polynomial() const {
+		return mPolynomial;
+	}
+
+	/// Returns the partial derivative with respect to v.
+	const Polynomial& derivative(Variable::Arg v) {
+		auto it = mDerivatives.find(v);
+		if (it == mDerivatives.end()) {
+			it = mDerivatives.emplace(v, mPolynomial.derivative(v)).first;
+		}
+		return it->second;
+	}
+	/// Returns the second order partial derivative with respect to v and w.
+	const Polynomial& derivative(Variable::Arg v, Variable::Arg w) {
+		auto key = (v < w) ? std::make_pair(v, w) : std::make_pair(w, v);
+		auto it = mSecondDerivatives.find(key);
+		if (it == mSecondDerivatives.end()) {
+			it = mSecondDerivatives.emplace(key, derivative(key.first).derivative(key.second)).first;
+		}
+		return it->second;
+	}
+
+	/**
+	 * Evaluates the polynomial over the given box in the given form.
+	 * @param box Either a std::map or an IntervalBox assigning intervals to all variables of the polynomial.
+	 * @param form The evaluation form.
+	 * @return An enclosure of the range of the polynomial over the box.
+	 */
+	template<typename Map>
+	Interval<double> evaluate(const Map& box, IntervalEvaluationForm form) {
+		if (form == IntervalEvaluationForm::Natural || mVariables.empty() || !setCenter(box)) {
+			return IntervalEvaluation::evaluate(mPolynomial, box);
+		}
+		switch (form) {
+			case IntervalEvaluationForm::MeanValue: return meanValue(box);
+			case IntervalEvaluationForm::Centered: return centered();
+			case IntervalEvaluationForm::Taylor: return taylor(box);
+			default: return IntervalEvaluation::evaluate(mPolynomial, box);
+		}
+	}
+};
+
+}
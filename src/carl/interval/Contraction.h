@@ -8,7 +8,9 @@
 #pragma once
 #include "Interval.h"
 #include "../core/Sign.h"
-#include "../core/MultivariateHorner.h"
+#include "../core/CompiledHorner.h"
+#include "CenteredEvaluation.h"
+#include "IntervalBox.h"
 #include "IntervalEvaluation.h"
 #include <algorithm>
 
@@ -189,15 +191,41 @@ namespace carl {
              */
             std::vector<Interval<double>> evaluate(const Interval<double>::evalintervalmap& intervals) const
             {
-                // evaluate monomial
                 std::vector<Interval<double>> result;
-                assert( intervals.find(mVar) != intervals.end() );
+                evaluateIn(intervals, result);
+                return result;
+            }
+
+            std::vector<Interval<double>> evaluate(const IntervalBox<double>& intervals) const
+            {
+                std::vector<Interval<double>> result;
+                evaluateIn(intervals, result);
+                return result;
+            }
+
+            /**
+             * Evaluates this solution formula into the given vector, which is cleared before.
+             * This allows to reuse the memory of the vector over multiple evaluations.
+             */
+            template<typename IntervalMap>
+            void evaluate(const IntervalMap& intervals, std::vector<Interval<double>>& result) const
+            {
+                evaluateIn(intervals, result);
+            }
+
+        private:
+            template<typename IntervalMap>
+            void evaluateIn(const IntervalMap& intervals, std::vector<Interval<double>>& result) const
+            {
+                // evaluate monomial
+                result.clear();
+                assert( intervals.count(mVar) > 0 );
                 const Interval<double>& varInterval = intervals.at(mVar);
                 Interval<double> numerator = IntervalEvaluation::evaluate(mNumerator, intervals);
                 if (mDenominator == nullptr)
                 {
                     addRoot( numerator, varInterval, result );
-                    return result;
+                    return;
                 }
                 Interval<double> denominator = IntervalEvaluation::evaluate(*mDenominator, intervals);        
                 Interval<double> result1, result2;
@@ -223,7 +251,6 @@ namespace carl {
                 {
                     addRoot( result1, varInterval, result );
                 }
-                return result;
             }
     };
 
@@ -234,13 +261,17 @@ namespace carl {
         Polynomial mConstraint; // Todo: Should be a reference.
         Polynomial* mpOriginal;
         #ifdef USE_HORNER
-        MultivariateHorner<Polynomial, strategy> mHornerForm;
-        std::map<Variable, MultivariateHorner<Polynomial,strategy>> mDerivatives;
-        #else
-        std::map<Variable, Polynomial> mDerivatives;
+        /// The Horner schemes are taken from the global cache, hence they are shared by all contractions of the same polynomial.
+        using HornerCache = HornerSchemeCache<Polynomial>;
+        typename HornerCache::SchemePtr mHornerForm;
+        std::map<Variable, typename HornerCache::SchemePtr> mDerivatives;
         #endif
+        /// Caches the derivatives of the polynomial, which are used for the Newton operator and the centered evaluation forms.
+        CenteredEvaluation<Polynomial> mEvaluation;
         std::map<Variable, VarSolutionFormula<Polynomial>> mVarSolutionFormulas;
-        std::map<Polynomial, MultivariateHorner<Polynomial,strategy>> mHornerSchemes;
+        /// Buffers for the intervals of the propagation, which are reused by all contractions.
+        std::vector<Interval<double>> mPropagation;
+        std::vector<Interval<double>> mIntersections;
 
     public:
         Contraction() = delete;
@@ -249,11 +280,11 @@ namespace carl {
             mConstraint(constraint),
             mpOriginal(nullptr),
             #ifdef USE_HORNER
-            mHornerForm(constraint),
-            #endif
+            mHornerForm(HornerCache::getInstance().get(constraint)),
             mDerivatives(),
-            mVarSolutionFormulas(),
-			mHornerSchemes()
+            #endif
+            mEvaluation(constraint),
+            mVarSolutionFormulas()
         {}
 
         Contraction(const Polynomial& constraint, const Polynomial& _original ):
@@ -261,11 +292,11 @@ namespace carl {
             mConstraint(constraint),
             mpOriginal (_original.isLinear() ? nullptr : new Polynomial(_original)),
             #ifdef USE_HORNER
-            mHornerForm( mpOriginal == nullptr ? constraint :  _original ),
-            #endif
+            mHornerForm(HornerCache::getInstance().get( mpOriginal == nullptr ? constraint :  _original )),
             mDerivatives(),
-            mVarSolutionFormulas() ,
-			mHornerSchemes()
+            #endif
+            mEvaluation( mpOriginal == nullptr ? constraint :  _original ),
+            mVarSolutionFormulas()
         {}
         Contraction(const Contraction&) = delete;
         
@@ -275,10 +306,10 @@ namespace carl {
             mpOriginal(_contraction.mpOriginal),
             #ifdef USE_HORNER
             mHornerForm(std::move(_contraction.mHornerForm)),
-            #endif
             mDerivatives(std::move(_contraction.mDerivatives)),
-            mVarSolutionFormulas(std::move(_contraction.mVarSolutionFormulas)),
-			mHornerSchemes(std::move(_contraction.mHornerSchemes))
+            #endif
+            mEvaluation(std::move(_contraction.mEvaluation)),
+            mVarSolutionFormulas(std::move(_contraction.mVarSolutionFormulas))
         {
             _contraction.mpOriginal = nullptr;
         }
@@ -298,40 +329,55 @@ namespace carl {
         }
 
         bool operator()(const Interval<double>::evalintervalmap& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
+        {
+            return apply(intervals, variable, resA, resB, useNiceCenter, usePropagation);
+        }
+
+        /**
+         * Contracts the given variable with respect to the intervals in the given box.
+         * Once the derivative and the solution formula for the variable have been computed, this does not allocate any memory,
+         * as the propagation reuses the buffers of this contraction.
+         */
+        bool operator()(const IntervalBox<double>& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter = false, bool usePropagation = false)
+        {
+            return apply(intervals, variable, resA, resB, useNiceCenter, usePropagation);
+        }
+
+        /**
+         * Encloses the range of the polynomial over the given intervals in the given evaluation form.
+         * Shares the derivatives with the contraction.
+         */
+        template<typename IntervalMap>
+        Interval<double> evaluate(const IntervalMap& intervals, IntervalEvaluationForm form)
+        {
+            return mEvaluation.evaluate(intervals, form);
+        }
+
+    private:
+        template<typename IntervalMap>
+        bool apply(const IntervalMap& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& resB, bool useNiceCenter, bool usePropagation)
         {
             bool splitOccurredInContraction = false;
             if( !usePropagation || mpOriginal == nullptr || !mConstraint.isLinear() )
             {
                 #ifdef USE_HORNER
-                typename std::map<Variable, MultivariateHorner<Polynomial,strategy>>::const_iterator it = mDerivatives.find(variable);
-                #else
-                typename std::map<Variable, Polynomial>::const_iterator it = mDerivatives.find(variable);
-                #endif
+                auto it = mDerivatives.find(variable);
 
                 if( it == mDerivatives.end() )
                 {
-                    #ifdef USE_HORNER
                     //Deriviate and convert to Horner
-                    if( mpOriginal == nullptr )
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mConstraint.derivative(variable)))).first;
-                    else
-                        it = mDerivatives.emplace(variable, std::move(MultivariateHorner<Polynomial, strategy>( mpOriginal->derivative(variable)))).first;
-                    #else
-                    if( mpOriginal == nullptr )
-                        it = mDerivatives.emplace(variable, mConstraint.derivative(variable)).first;
-                    else
-                        it = mDerivatives.emplace(variable, mpOriginal->derivative(variable)).first;
-                    #endif
+                    it = mDerivatives.emplace(variable, HornerCache::getInstance().get(mEvaluation.derivative(variable))).first;
                 }
+                #endif
 
                 #ifdef CONTRACTION_DEBUG
                 std::cout << __func__ << ": contraction of " << variable << " with " << intervals << " in " << mConstraint << " mpOriginal: " << mpOriginal << std::endl;
                 #endif
 
                 #ifdef USE_HORNER
-                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, mHornerForm, (*it).second, resA, resB, useNiceCenter);
+                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, *mHornerForm, *(*it).second, resA, resB, useNiceCenter);
                 #else
-                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), (*it).second, resA, resB, useNiceCenter);
+                splitOccurredInContraction = Operator<Polynomial>::contract(intervals, variable, (mpOriginal == nullptr ? mConstraint : *mpOriginal), mEvaluation.derivative(variable), resA, resB, useNiceCenter);
                 #endif
             }
             else
@@ -355,7 +401,8 @@ namespace carl {
                 }
                 
                 // calculate result of propagation
-                std::vector<Interval<double>> resultPropagation = const_iterator_VarSolutionFormula->second.evaluate( intervals );
+                std::vector<Interval<double>>& resultPropagation = mPropagation;
+                const_iterator_VarSolutionFormula->second.evaluate( intervals, resultPropagation );
                 
                 #ifdef CONTRACTION_DEBUG
                 std::cout << "  propagation result: " << resultPropagation << std::endl;                            
@@ -372,7 +419,8 @@ namespace carl {
                 }
 
                 // intersect with result of contraction
-                std::vector<Interval<double>> resultingIntervals;
+                std::vector<Interval<double>>& resultingIntervals = mIntersections;
+                resultingIntervals.clear();
                 if( splitOccurredInContraction )
                 {   
                     Interval<double> tmp;
@@ -484,10 +532,24 @@ namespace carl {
 
     template<typename Polynomial>
     class SimpleNewton {
+    private:
+        static Interval<double>::evalintervalmap substitute(const Interval<double>::evalintervalmap& intervals, Variable::Arg variable, const Interval<double>& interval)
+        {
+            Interval<double>::evalintervalmap result = intervals;
+            result[variable] = interval;
+            return result;
+        }
+
+        /// Substitution on a box only creates an overlay and does not copy the box.
+        static IntervalBox<double> substitute(const IntervalBox<double>& intervals, Variable::Arg variable, const Interval<double>& interval)
+        {
+            return intervals.overlay(variable, interval);
+        }
+
     public:
         
-        template <typename evalType>
-        bool contract(const Interval<double>::evalintervalmap& intervals, 
+        template <typename evalType, typename IntervalMap>
+        bool contract(const IntervalMap& intervals, 
             Variable::Arg variable, 
             const evalType& constraint, 
             const evalType& derivative, 
@@ -513,8 +575,7 @@ namespace carl {
 			#endif
 			
             // Create map for replacement of variables by intervals and replacement of center by point interval
-            typename Interval<double>::evalintervalmap substitutedIntervalMap = intervals;
-            substitutedIntervalMap[variable] = centerInterval;
+            auto substitutedIntervalMap = substitute(intervals, variable, centerInterval);
 
             Interval<double> numerator (0);
             Interval<double> denominator(0);
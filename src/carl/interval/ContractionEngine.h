@@ -0,0 +1,285 @@
+/**
+ * @file ContractionEngine.h
+ *
+ * Interval constraint propagation over a set of polynomial equations.
+ *
+ * The engine repeatedly contracts the intervals of a box with respect to single constraints and variables using Contraction or HC4.
+ * Contraction candidates are scheduled by a priority queue that prefers candidates whose variables were reduced the most recently,
+ * known as the relative reduction heuristic.
+ * Candidates of different constraints are independent and may be contracted by multiple threads.
+ * As HC4 narrows all variables of a constraint at once, its candidates are whole constraints instead of pairs of a constraint and a variable.
+ */
+
+#pragma once
+
+#include "../config.h"
+#include "Contraction.h"
+#include "HC4.h"
+#include "IntervalBox.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace carl {
+
+template<typename Polynomial>
+class ContractionEngine {
+public:
+	struct Settings {
+		/// Number of threads, only used with THREAD_SAFE.
+		std::size_t threads = 1;
+		/// Maximum number of contractions per call to contract().
+		std::size_t maxContractions = 10000;
+		/// Minimum relative reduction of an interval to schedule the contractions depending on it again.
+		double minReduction = 0.01;
+		/// Whether Contraction also propagates the solution formula of the constraint, see VarSolutionFormula.
+		bool usePropagation = false;
+		/// Whether to use the cheaper forward-backward propagation of HC4 instead of the Newton operator.
+		bool useHC4 = false;
+	};
+
+	struct Statistics {
+		std::size_t contractions = 0;
+		/// Number of contractions that actually reduced an interval.
+		std::size_t reductions = 0;
+		/// Number of batches of independent contractions.
+		std::size_t batches = 0;
+		/// Time in microseconds.
+		std::size_t time = 0;
+		/// Average of new width / old width over all bounded intervals of the box.
+		double relativeWidth = 1;
+
+		double contractionsPerSecond() const {
+			if (time == 0) return 0;
+			return double(contractions) * 1000000 / double(time);
+		}
+	};
+private:
+	using Contractor = Contraction<SimpleNewton, Polynomial>;
+
+	struct Candidate {
+		double priority;
+		std::size_t constraint;
+		/// The variable to contract, or NO_VARIABLE for all variables with HC4.
+		Variable variable;
+
+		bool operator<(const Candidate& rhs) const {
+			return priority < rhs.priority;
+		}
+	};
+	struct Result {
+		Interval<double> resA;
+		Interval<double> resB;
+		bool split;
+		/// With HC4, whether the box may contain a solution and the narrowed intervals of the variables of the HC4 operator.
+		bool consistent;
+		std::vector<Interval<double>> narrowed;
+	};
+
+	Settings mSettings;
+	std::vector<std::unique_ptr<Contractor>> mContractors;
+	/// HC4 operators, which are only created if Settings::useHC4 is set.
+	std::vector<std::unique_ptr<HC4<Polynomial>>> mHC4;
+	/// Variables of every constraint.
+	std::vector<std::vector<Variable>> mVariables;
+	/// For every variable, the constraints it occurs in.
+	std::map<Variable, std::vector<std::size_t>> mOccurrences;
+	Statistics mStatistics;
+
+	/// Relative movement of a single bound, which is one if an infinite bound became finite.
+	static double reduction(BoundType oldType, double oldBound, BoundType newType, double newBound) {
+		if (oldType == BoundType::INFTY) return newType == BoundType::INFTY ? 0 : 1;
+		return std::abs(newBound - oldBound) / std::max(std::abs(oldBound), 1.0);
+	}
+	/**
+	 * Relative reduction from old to new, where new is contained in old.
+	 * For bounded intervals, this is the relative reduction of the width.
+	 * Otherwise, the reduction is measured for every bound, such that narrowing a single bound of an unbounded interval counts as well.
+	 */
+	static double reduction(const Interval<double>& oldInterval, const Interval<double>& newInterval) {
+		if (newInterval.isEmpty()) return 1;
+		if (oldInterval.isUnbounded()) {
+			return std::max(
+				reduction(oldInterval.lowerBoundType(), oldInterval.lower(), newInterval.lowerBoundType(), newInterval.lower()),
+				reduction(oldInterval.upperBoundType(), oldInterval.upper(), newInterval.upperBoundType(), newInterval.upper())
+			);
+		}
+		double oldWidth = oldInterval.diameter();
+		if (oldWidth <= 0) return 0;
+		return (oldWidth - newInterval.diameter()) / oldWidth;
+	}
+
+	/// Contracts all candidates on the same box, possibly in parallel.
+	std::vector<Result> execute(const std::vector<Candidate>& batch, const IntervalBox<double>& box) {
+		std::vector<Result> results(batch.size());
+		std::atomic<std::size_t> next(0);
+		auto worker = [&]() {
+			for (std::size_t i = next++; i < batch.size(); i = next++) {
+				Result& r = results[i];
+				if (mSettings.useHC4) {
+					r.split = false;
+					r.consistent = mHC4[batch[i].constraint]->revise(box, r.narrowed);
+				} else {
+					r.split = (*mContractors[batch[i].constraint])(box, batch[i].variable, r.resA, r.resB, false, mSettings.usePropagation);
+				}
+			}
+		};
+#ifdef THREAD_SAFE
+		std::size_t threads = std::min(mSettings.threads, batch.size());
+		if (threads > 1) {
+			std::vector<std::thread> pool;
+			for (std::size_t t = 0; t < threads; t++) {
+				pool.emplace_back(worker);
+			}
+			for (auto& t: pool) t.join();
+			return results;
+		}
+#endif
+		worker();
+		return results;
+	}
+public:
+	/**
+	 * Creates an engine for the equations p = 0 for all given polynomials.
+	 * The contractors and their derivatives are kept over all calls to contract().
+	 */
+	explicit ContractionEngine(const std::vector<Polynomial>& constraints, const Settings& settings = Settings()):
+		mSettings(settings)
+	{
+		for (const auto& p: constraints) {
+			mContractors.emplace_back(new Contractor(p));
+			auto vars = p.gatherVariables();
+			mVariables.emplace_back(vars.begin(), vars.end());
+			for (auto v: vars) mOccurrences[v].push_back(mContractors.size() - 1);
+		}
+	}
+
+	Settings& settings() {
+		return mSettings;
+	}
+	/// Statistics of the last call to contract().
+	const Statistics& statistics() const {
+		return mStatistics;
+	}
+
+	/**
+	 * Contracts the box until a fixed point is reached, the budget is exhausted or the box becomes empty.
+	 * @param box Box that assigns intervals to all variables of the constraints.
+	 * @return false, if the box was found to contain no solution.
+	 */
+	bool contract(IntervalBox<double>& box) {
+		mStatistics = Statistics();
+		auto start = std::chrono::steady_clock::now();
+		if (mSettings.useHC4 && mHC4.empty()) {
+			for (const auto& c: mContractors) mHC4.emplace_back(new HC4<Polynomial>(c->polynomial()));
+		}
+		IntervalBox<double> initial = box;
+
+		std::priority_queue<Candidate> queue;
+		std::vector<std::vector<bool>> queued(mContractors.size());
+		auto index = [&](std::size_t c, Variable::Arg v) {
+			if (mSettings.useHC4) return std::size_t(0);
+			return std::size_t(std::find(mVariables[c].begin(), mVariables[c].end(), v) - mVariables[c].begin());
+		};
+		for (std::size_t c = 0; c < mContractors.size(); c++) {
+			if (mSettings.useHC4) {
+				queued[c].assign(1, true);
+				queue.push(Candidate{ 1, c, Variable::NO_VARIABLE });
+				continue;
+			}
+			queued[c].assign(mVariables[c].size(), true);
+			for (auto v: mVariables[c]) queue.push(Candidate{ 1, c, v });
+		}
+		auto enqueue = [&](std::size_t c, Variable::Arg v, double priority) {
+			std::size_t i = index(c, v);
+			if (queued[c][i]) return;
+			queued[c][i] = true;
+			queue.push(Candidate{ priority, c, v });
+		};
+		// Sets the contracted interval of v and schedules the depending candidates, returns false if the box became empty.
+		// Every narrowing is kept, but only significant reductions schedule the depending candidates again.
+		auto update = [&](Variable::Arg v, Interval<double> contracted) {
+			const Interval<double>& old = box.at(v);
+			contracted = contracted.intersect(old);
+			if (contracted == old) return true;
+			double r = reduction(old, contracted);
+			mStatistics.reductions++;
+			box.set(v, contracted);
+			if (contracted.isEmpty()) return false;
+			if (r < mSettings.minReduction) return true;
+			// This includes the candidate itself, as contracting again with the new interval may further reduce it.
+			for (std::size_t c: mOccurrences[v]) {
+				if (mSettings.useHC4) enqueue(c, Variable::NO_VARIABLE, r);
+				else for (auto w: mVariables[c]) enqueue(c, w, r);
+			}
+			return true;
+		};
+
+		bool empty = false;
+		std::size_t batchSize = std::max(mSettings.threads, std::size_t(1)) * 4;
+		std::vector<Candidate> batch;
+		std::vector<Candidate> deferred;
+		std::vector<bool> inBatch(mContractors.size(), false);
+		while (!queue.empty() && !empty && mStatistics.contractions < mSettings.maxContractions) {
+			// Take the best candidates, at most one per constraint as contractors are not thread-safe.
+			batch.clear();
+			deferred.clear();
+			while (!queue.empty() && batch.size() < batchSize && mStatistics.contractions + batch.size() < mSettings.maxContractions) {
+				Candidate cand = queue.top();
+				queue.pop();
+				if (inBatch[cand.constraint]) {
+					deferred.push_back(cand);
+					continue;
+				}
+				inBatch[cand.constraint] = true;
+				batch.push_back(cand);
+			}
+			for (const auto& cand: deferred) queue.push(cand);
+			for (const auto& cand: batch) {
+				inBatch[cand.constraint] = false;
+				queued[cand.constraint][index(cand.constraint, cand.variable)] = false;
+			}
+
+			auto results = execute(batch, box);
+			mStatistics.batches++;
+			mStatistics.contractions += batch.size();
+			for (std::size_t i = 0; i < batch.size() && !empty; i++) {
+				if (mSettings.useHC4) {
+					const auto& variables = mHC4[batch[i].constraint]->variables();
+					if (!results[i].consistent) {
+						empty = variables.empty() || !update(variables.front(), Interval<double>::emptyInterval());
+						continue;
+					}
+					for (std::size_t j = 0; j < variables.size() && !empty; j++) {
+						empty = !update(variables[j], results[i].narrowed[j]);
+					}
+					continue;
+				}
+				Interval<double> contracted = results[i].resA;
+				if (results[i].split) contracted = contracted.convexHull(results[i].resB);
+				empty = !update(batch[i].variable, contracted);
+			}
+		}
+
+		std::size_t bounded = 0;
+		double relativeWidth = 0;
+		if (!empty) {
+			initial.forEach([&](Variable::Arg v, const Interval<double>& i){
+				if (i.isUnbounded() || i.diameter() <= 0) return;
+				bounded++;
+				relativeWidth += box.at(v).diameter() / i.diameter();
+			});
+		}
+		mStatistics.relativeWidth = empty ? 0 : (bounded == 0 ? 1 : relativeWidth / double(bounded));
+		mStatistics.time = std::size_t(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+		return !empty;
+	}
+};
+
+}
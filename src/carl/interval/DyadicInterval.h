@@ -0,0 +1,99 @@
+/**
+ * @file DyadicInterval.h
+ *
+ * Conversions between intervals with dyadic endpoints and intervals over rationals or doubles.
+ *
+ * Endpoints of Interval<mpq_class> grow with every operation, for example while refining isolating intervals or contracting boxes.
+ * Converting such intervals to Interval<Dyadic> rounds the endpoints outwards to a fixed number of bits,
+ * which keeps their size bounded while the result still contains the original interval.
+ */
+
+#pragma once
+
+#include "Interval.h"
+
+#include <cmath>
+#include <limits>
+
+namespace carl {
+
+namespace dyadic_detail {
+	/// Returns the largest double that is at most d, or -infinity if there is none.
+	inline double roundDown(const Dyadic& d) {
+		double res = d.toDouble();
+		if (res == std::numeric_limits<double>::infinity()) return std::numeric_limits<double>::max();
+		if (std::isinf(res)) return res;
+		if (Dyadic(res) > d) res = std::nextafter(res, -std::numeric_limits<double>::infinity());
+		return res;
+	}
+	/// Returns the smallest double that is at least d, or infinity if there is none.
+	inline double roundUp(const Dyadic& d) {
+		return -roundDown(-d);
+	}
+}
+
+/**
+ * Rounds the bounds of the interval outwards to the given number of bits.
+ * The bound types are kept, hence the result contains the given interval.
+ */
+inline Interval<Dyadic> roundOutward(const Interval<Dyadic>& i, std::size_t precision = Dyadic::precision()) {
+	if (i.isEmpty()) return Interval<Dyadic>::emptyInterval();
+	Dyadic lower = (i.lowerBoundType() == BoundType::INFTY) ? Dyadic(0) : i.lower().round(precision, false);
+	Dyadic upper = (i.upperBoundType() == BoundType::INFTY) ? Dyadic(0) : i.upper().round(precision, true);
+	return Interval<Dyadic>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+}
+
+/**
+ * Converts a rational interval to the smallest interval with dyadic bounds of the given precision containing it.
+ */
+inline Interval<Dyadic> toDyadicInterval(const Interval<mpq_class>& i, std::size_t precision = Dyadic::precision()) {
+	if (i.isEmpty()) return Interval<Dyadic>::emptyInterval();
+	Dyadic lower = (i.lowerBoundType() == BoundType::INFTY) ? Dyadic(0) : Dyadic::roundDown(i.lower(), precision);
+	Dyadic upper = (i.upperBoundType() == BoundType::INFTY) ? Dyadic(0) : Dyadic::roundUp(i.upper(), precision);
+	return Interval<Dyadic>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+}
+
+/**
+ * Converts a double interval to an interval with dyadic bounds.
+ * This conversion is exact, as every finite double is a dyadic number.
+ */
+inline Interval<Dyadic> toDyadicInterval(const Interval<double>& i) {
+	if (i.isEmpty()) return Interval<Dyadic>::emptyInterval();
+	Dyadic lower = (i.lowerBoundType() == BoundType::INFTY) ? Dyadic(0) : Dyadic(i.lower());
+	Dyadic upper = (i.upperBoundType() == BoundType::INFTY) ? Dyadic(0) : Dyadic(i.upper());
+	return Interval<Dyadic>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+}
+
+/**
+ * Converts an interval with dyadic bounds to a rational interval. This conversion is exact.
+ */
+inline Interval<mpq_class> toRationalInterval(const Interval<Dyadic>& i) {
+	if (i.isEmpty()) return Interval<mpq_class>::emptyInterval();
+	mpq_class lower = (i.lowerBoundType() == BoundType::INFTY) ? mpq_class(0) : i.lower().toRational();
+	mpq_class upper = (i.upperBoundType() == BoundType::INFTY) ? mpq_class(0) : i.upper().toRational();
+	return Interval<mpq_class>(lower, i.lowerBoundType(), upper, i.upperBoundType());
+}
+
+/**
+ * Converts an interval with dyadic bounds to the smallest double interval containing it.
+ */
+inline Interval<double> toDoubleInterval(const Interval<Dyadic>& i) {
+	if (i.isEmpty()) return Interval<double>::emptyInterval();
+	BoundType lowerType = i.lowerBoundType();
+	BoundType upperType = i.upperBoundType();
+	double lower = 0;
+	double upper = 0;
+	if (lowerType != BoundType::INFTY) {
+		lower = dyadic_detail::roundDown(i.lower());
+		if (std::isinf(lower)) lowerType = BoundType::INFTY;
+	}
+	if (upperType != BoundType::INFTY) {
+		upper = dyadic_detail::roundUp(i.upper());
+		if (std::isinf(upper)) upperType = BoundType::INFTY;
+	}
+	if (lowerType == BoundType::INFTY) lower = 0;
+	if (upperType == BoundType::INFTY) upper = 0;
+	return Interval<double>(lower, lowerType, upper, upperType);
+}
+
+}
@@ -0,0 +1,270 @@
+/**
+ * @file HC4.h
+ *
+ * Interval constraint propagation by forward and backward evaluation of an expression DAG (HC4 revise).
+ *
+ * The constraint p ~ 0 is compiled once into a DAG whose leaves are the variables, followed by the powers of the variables
+ * (shared among all terms), the terms and finally the sum of all terms.
+ * The forward pass evaluates all nodes over the box. The backward pass intersects the root with the solutions of the relation
+ * and narrows every node from the values of its parents by the inverse operations, which finally narrows the variables.
+ * Contrary to the Newton operator in Contraction, no derivatives are needed and all variables are narrowed at once.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "IntervalBox.h"
+#include "../core/Relation.h"
+#include "../core/Variable.h"
+
+#include <cassert>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+template<typename Polynomial>
+class HC4 {
+private:
+	enum class NodeType { Variable, Power, Term, Sum };
+	struct Node {
+		NodeType type;
+		/// Variable of a variable node.
+		Variable variable;
+		/// Exponent of a power node.
+		uint exponent;
+		/// Coefficient of a term node or constant part of the sum node.
+		Interval<double> constant;
+		/// Indices of the children, which are smaller than the index of this node.
+		std::vector<std::size_t> children;
+	};
+
+	Relation mRelation;
+	/// Nodes in topological order, the last one being the root.
+	std::vector<Node> mNodes;
+	/// Indices of the variable nodes.
+	std::vector<std::size_t> mVariableNodes;
+	/// Variables of the variable nodes, in the same order.
+	std::vector<Variable> mVariables;
+	/// Values of the nodes, reused among calls.
+	std::vector<Interval<double>> mValues;
+	/// Partial sums or products of the children of a node, reused among calls.
+	std::vector<Interval<double>> mPrefix;
+	std::vector<Interval<double>> mSuffix;
+
+	std::size_t addNode(NodeType type, Variable::Arg v, uint exponent, const Interval<double>& constant, std::vector<std::size_t>&& children) {
+		mNodes.push_back(Node{ type, v, exponent, constant, std::move(children) });
+		return mNodes.size() - 1;
+	}
+
+	/// Returns the solutions of the relation, i.e. the set of values the root may attain.
+	Interval<double> solutions() const {
+		switch (mRelation) {
+			case Relation::EQ: return Interval<double>(0.0);
+			case Relation::LESS:
+			case Relation::LEQ: return Interval<double>(0.0, BoundType::INFTY, 0.0, BoundType::WEAK);
+			case Relation::GREATER:
+			case Relation::GEQ: return Interval<double>(0.0, BoundType::WEAK, 0.0, BoundType::INFTY);
+			default: return Interval<double>::unboundedInterval();
+		}
+	}
+
+	/// Intersects the value of the node with the given interval, returns false if it becomes empty.
+	bool narrow(std::size_t node, const Interval<double>& i) {
+		mValues[node] = mValues[node].intersect(i);
+		return !mValues[node].isEmpty();
+	}
+
+	/// Computes the sum (or product) of the constant and all children but the i'th one into mPrefix[i].
+	template<typename F>
+	void others(const Node& n, const Interval<double>& neutral, F&& op) {
+		std::size_t k = n.children.size();
+		mPrefix.assign(k + 1, n.constant);
+		mSuffix.assign(k + 1, neutral);
+		for (std::size_t i = 0; i < k; i++) mPrefix[i+1] = op(mPrefix[i], mValues[n.children[i]]);
+		for (std::size_t i = k; i > 0; i--) mSuffix[i-1] = op(mSuffix[i], mValues[n.children[i-1]]);
+		for (std::size_t i = 0; i < k; i++) mPrefix[i] = op(mPrefix[i], mSuffix[i+1]);
+	}
+
+	void forward() {
+		for (std::size_t i = 0; i < mNodes.size(); i++) {
+			const Node& n = mNodes[i];
+			switch (n.type) {
+				case NodeType::Variable: break;
+				case NodeType::Power:
+					mValues[i] = mValues[n.children.front()].pow(n.exponent);
+					break;
+				case NodeType::Term:
+					mValues[i] = n.constant;
+					for (auto c: n.children) mValues[i] = mValues[i].mul(mValues[c]);
+					break;
+				case NodeType::Sum:
+					mValues[i] = n.constant;
+					for (auto c: n.children) mValues[i] = mValues[i].add(mValues[c]);
+					break;
+			}
+		}
+	}
+
+	bool backward() {
+		for (std::size_t i = mNodes.size(); i > 0; i--) {
+			const Node& n = mNodes[i-1];
+			const Interval<double>& value = mValues[i-1];
+			switch (n.type) {
+				case NodeType::Variable: break;
+				case NodeType::Power: {
+					std::size_t c = n.children.front();
+					Interval<double> root = value.root(int(n.exponent));
+					if (n.exponent % 2 == 0) {
+						// Both the positive and the negative root are solutions.
+						Interval<double> pos = mValues[c].intersect(root);
+						Interval<double> neg = mValues[c].intersect(Interval<double>(0.0).sub(root));
+						root = pos.isEmpty() ? neg : (neg.isEmpty() ? pos : pos.convexHull(neg));
+					}
+					if (!narrow(c, root)) return false;
+					break;
+				}
+				case NodeType::Term: {
+					others(n, Interval<double>(1.0), [](const Interval<double>& a, const Interval<double>& b){ return a.mul(b); });
+					for (std::size_t k = 0; k < n.children.size(); k++) {
+						Interval<double> resA;
+						Interval<double> resB;
+						if (value.div_ext(mPrefix[k], resA, resB)) {
+							resA = mValues[n.children[k]].intersect(resA).convexHull(mValues[n.children[k]].intersect(resB));
+						}
+						if (!narrow(n.children[k], resA)) return false;
+					}
+					break;
+				}
+				case NodeType::Sum: {
+					others(n, Interval<double>(0.0), [](const Interval<double>& a, const Interval<double>& b){ return a.add(b); });
+					for (std::size_t k = 0; k < n.children.size(); k++) {
+						if (!narrow(n.children[k], value.sub(mPrefix[k]))) return false;
+					}
+					break;
+				}
+			}
+		}
+		return true;
+	}
+
+	template<typename Map>
+	bool apply(const Map& box) {
+		for (auto i: mVariableNodes) mValues[i] = box.at(mNodes[i].variable);
+		forward();
+		if (!narrow(mNodes.size() - 1, solutions())) return false;
+		return backward();
+	}
+
+	static void assign(Interval<double>::evalintervalmap& box, Variable::Arg v, const Interval<double>& i) {
+		box[v] = i;
+	}
+	static void assign(IntervalBox<double>& box, Variable::Arg v, const Interval<double>& i) {
+		box.set(v, i);
+	}
+public:
+	/**
+	 * Compiles the constraint p ~ 0 into an expression DAG.
+	 * @param p Polynomial.
+	 * @param relation Relation, where NEQ does not allow for any narrowing.
+	 */
+	explicit HC4(const Polynomial& p, Relation relation = Relation::EQ):
+		mRelation(relation)
+	{
+		std::map<Variable, std::size_t> variables;
+		std::map<std::pair<Variable,uint>, std::size_t> powers;
+		std::vector<std::size_t> terms;
+		Interval<double> constant(0.0);
+		for (const auto& term: p) {
+			Interval<double> coeff(term.coeff());
+			if (!term.monomial()) {
+				constant = constant.add(coeff);
+				continue;
+			}
+			std::vector<std::size_t> factors;
+			for (const auto& ve: *term.monomial()) {
+				auto vit = variables.find(ve.first);
+				if (vit == variables.end()) {
+					vit = variables.emplace(ve.first, addNode(NodeType::Variable, ve.first, 1, Interval<double>(1.0), {})).first;
+					mVariableNodes.push_back(vit->second);
+					mVariables.push_back(ve.first);
+				}
+				if (ve.second == 1) {
+					factors.push_back(vit->second);
+					continue;
+				}
+				auto pit = powers.find(ve);
+				if (pit == powers.end()) {
+					pit = powers.emplace(ve, addNode(NodeType::Power, Variable::NO_VARIABLE, ve.second, Interval<double>(1.0), { vit->second })).first;
+				}
+				factors.push_back(pit->second);
+			}
+			terms.push_back(addNode(NodeType::Term, Variable::NO_VARIABLE, 1, coeff, std::move(factors)));
+		}
+		addNode(NodeType::Sum, Variable::NO_VARIABLE, 1, constant, std::move(terms));
+		mValues.resize(mNodes.size());
+	}
+
+	Relation relation() const {
+		return mRelation;
+	}
+	/// Number of nodes of the DAG.
+	std::size_t size() const {
+		return mNodes.size();
+	}
+	/// The variables of the constraint, in the order used by revise() with a result vector.
+	const std::vector<Variable>& variables() const {
+		return mVariables;
+	}
+
+	/**
+	 * Narrows all intervals of the box with respect to the constraint.
+	 * @param box Either a std::map or an IntervalBox assigning intervals to all variables of the constraint.
+	 * @return false, if the box was found to contain no solution. The box may be partially narrowed in this case.
+	 */
+	template<typename Map>
+	bool revise(Map& box) {
+		bool res = apply(box);
+		if (!res) return false;
+		for (auto i: mVariableNodes) assign(box, mNodes[i].variable, mValues[i]);
+		return true;
+	}
+
+	/**
+	 * Narrows all intervals of the box with respect to the constraint, without changing the box.
+	 * @param box Either a std::map or an IntervalBox assigning intervals to all variables of the constraint.
+	 * @param result Is set to the narrowed intervals of variables().
+	 * @return false, if the box was found to contain no solution.
+	 */
+	template<typename Map>
+	bool revise(const Map& box, std::vector<Interval<double>>& result) {
+		result.clear();
+		if (!apply(box)) return false;
+		for (auto i: mVariableNodes) result.push_back(mValues[i]);
+		return true;
+	}
+
+	/**
+	 * Narrows the interval of a single variable, with the same interface as Contraction.
+	 * HC4 never splits, hence resB is not changed and false is returned.
+	 * If the box contains no solution, resA is empty.
+	 */
+	template<typename Map>
+	bool operator()(const Map& intervals, Variable::Arg variable, Interval<double>& resA, Interval<double>& /*resB*/) {
+		if (!apply(intervals)) {
+			resA = Interval<double>::emptyInterval();
+			return false;
+		}
+		for (auto i: mVariableNodes) {
+			if (mNodes[i].variable == variable) {
+				resA = mValues[i];
+				return false;
+			}
+		}
+		resA = intervals.at(variable);
+		return false;
+	}
+};
+
+}
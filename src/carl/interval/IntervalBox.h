@@ -0,0 +1,143 @@
+/**
+ * @file IntervalBox.h
+ *
+ * A dense assignment of variables to intervals, indexed by the variable id and type.
+ *
+ * In contrast to std::map<Variable, Interval<Number>>, looking up the interval of a variable is a plain vector access.
+ * An IntervalBox can also be an overlay of another box that replaces the interval of a single variable.
+ * Creating such an overlay does neither copy the underlying box nor allocate any memory, which makes it suitable for the inner loop of interval contraction.
+ */
+
+#pragma once
+
+#include "Interval.h"
+#include "../core/Variable.h"
+#include "../io/streamingOperators.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <vector>
+
+namespace carl {
+
+template<typename Number>
+class IntervalBox {
+private:
+	/// Intervals indexed by slot(v).
+	std::vector<Interval<Number>> mIntervals;
+	/// The variable stored in the respective slot, or NO_VARIABLE.
+	std::vector<Variable> mVariables;
+	/// The box this box is an overlay of, or nullptr.
+	const IntervalBox* mBase = nullptr;
+	/// The variable replaced by this overlay.
+	Variable mOverlayVariable = Variable::NO_VARIABLE;
+	/// The interval of mOverlayVariable in this overlay.
+	Interval<Number> mOverlayInterval;
+
+	IntervalBox(const IntervalBox& base, Variable::Arg v, const Interval<Number>& interval):
+		mBase(&base), mOverlayVariable(v), mOverlayInterval(interval)
+	{}
+
+	/// Variable ids are only unique per type, hence the slot of a variable combines id and type.
+	static std::size_t slot(Variable::Arg v) {
+		return v.id() * static_cast<std::size_t>(VariableType::TYPE_SIZE) + static_cast<std::size_t>(v.type());
+	}
+public:
+	IntervalBox() = default;
+	/// Creates a box holding the same intervals as the given map.
+	explicit IntervalBox(const std::map<Variable, Interval<Number>>& map) {
+		std::size_t size = 0;
+		for (const auto& i: map) size = std::max(size, slot(i.first) + 1);
+		mIntervals.resize(size);
+		mVariables.resize(size, Variable::NO_VARIABLE);
+		for (const auto& i: map) set(i.first, i.second);
+	}
+
+	/**
+	 * Creates an overlay of this box where the interval of the given variable is replaced.
+	 * The overlay refers to this box, hence this box must outlive the overlay and should not be modified while the overlay is in use.
+	 */
+	IntervalBox overlay(Variable::Arg v, const Interval<Number>& interval) const {
+		return IntervalBox(*this, v, interval);
+	}
+	/// Checks whether this box is an overlay of another box.
+	bool isOverlay() const {
+		return mBase != nullptr;
+	}
+
+	/// Makes sure that variables up to the given one can be set without reallocation.
+	void reserve(Variable::Arg v) {
+		assert(!isOverlay());
+		if (mIntervals.size() <= slot(v)) {
+			mIntervals.resize(slot(v) + 1);
+			mVariables.resize(slot(v) + 1, Variable::NO_VARIABLE);
+		}
+	}
+
+	/// Checks whether an interval is stored for the given variable.
+	bool has(Variable::Arg v) const {
+		if (isOverlay()) return v == mOverlayVariable || mBase->has(v);
+		return slot(v) < mVariables.size() && mVariables[slot(v)] == v;
+	}
+	/// Returns 1 if an interval is stored for the given variable and 0 otherwise, like std::map::count().
+	std::size_t count(Variable::Arg v) const {
+		return has(v) ? 1 : 0;
+	}
+	/// Returns the interval of the given variable, which must be stored in this box.
+	const Interval<Number>& at(Variable::Arg v) const {
+		if (isOverlay()) return (v == mOverlayVariable) ? mOverlayInterval : mBase->at(v);
+		assert(has(v));
+		return mIntervals[slot(v)];
+	}
+
+	/// Sets the interval of the given variable, only allocates if the variable id was not reserved yet.
+	void set(Variable::Arg v, const Interval<Number>& interval) {
+		assert(!isOverlay());
+		reserve(v);
+		mIntervals[slot(v)] = interval;
+		mVariables[slot(v)] = v;
+	}
+	/// Removes the interval of the given variable.
+	void erase(Variable::Arg v) {
+		assert(!isOverlay());
+		if (has(v)) mVariables[slot(v)] = Variable::NO_VARIABLE;
+	}
+
+	/**
+	 * Calls f(variable, interval) for every variable stored in this box.
+	 * The order is determined by the variable ids and does not necessarily coincide with the order of variables.
+	 */
+	template<typename F>
+	void forEach(F&& f) const {
+		const IntervalBox* root = this;
+		while (root->isOverlay()) root = root->mBase;
+		for (std::size_t s = 0; s < root->mVariables.size(); s++) {
+			if (root->mVariables[s] != Variable::NO_VARIABLE) f(root->mVariables[s], at(root->mVariables[s]));
+		}
+		// Variables that only occur in overlays, each reported once for the outermost overlay.
+		for (const IntervalBox* b = this; b->isOverlay(); b = b->mBase) {
+			if (root->has(b->mOverlayVariable)) continue;
+			bool shadowed = false;
+			for (const IntervalBox* c = this; c != b; c = c->mBase) {
+				if (c->mOverlayVariable == b->mOverlayVariable) shadowed = true;
+			}
+			if (!shadowed) f(b->mOverlayVariable, b->mOverlayInterval);
+		}
+	}
+
+	/// Converts this box to an ordinary map.
+	std::map<Variable, Interval<Number>> toMap() const {
+		std::map<Variable, Interval<Number>> res;
+		forEach([&res](Variable::Arg v, const Interval<Number>& i){ res.emplace(v, i); });
+		return res;
+	}
+};
+
+template<typename Number>
+inline std::ostream& operator<<(std::ostream& os, const IntervalBox<Number>& box) {
+	return os << box.toMap();
+}
+
+}
@@ -7,6 +7,7 @@
 
 #pragma once
 #include "Interval.h"
+#include "IntervalBox.h"
 
 #include "../core/Monomial.h"
 #include "../core/Term.h"
@@ -21,40 +22,113 @@ namespace carl
 template<typename PolynomialType, class strategy  >
 class MultivariateHorner; 
 
+template<typename Polynomial>
+class CompiledHorner;
+
 class IntervalEvaluation
 {
 public:
 	template<typename Numeric>
-	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>&);
+	static Interval<Numeric> evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateIn<Numeric>(m, map);
+	}
 
-	template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
-	
-	template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>&);
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateIn<Numeric>(t, map);
+	}
 
 	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>&);
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateIn<Numeric>(p, map);
+	}
     
 	template<typename P, typename Numeric>
-	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>&);
+	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateIn<Numeric>(p, map);
+	}
 
-	template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
-	
-	template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
-	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map);
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+		return evaluateIn<Numeric>(p, map);
+	}
 	
 	template<typename PolynomialType, typename Number, class strategy>
-	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map);
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map) {
+		return evaluateIn<Number>(mvH, map);
+	}
+
+	template<typename PolynomialType>
+	static Interval<double> evaluate(const CompiledHorner<PolynomialType>& h, const std::map<Variable, Interval<double>>& map) {
+		return h.evaluate(map);
+	}
+
+	/**
+	 * The following overloads evaluate on an IntervalBox.
+	 * Other than the overloads for std::map, they do not allocate any memory, also if the box is an overlay.
+	 */
+	template<typename Numeric>
+	static Interval<Numeric> evaluate(const Monomial& m, const IntervalBox<Numeric>& box) {
+		return evaluateIn<Numeric>(m, box);
+	}
+
+	template<typename Coeff, typename Numeric>
+	static Interval<Numeric> evaluate(const Term<Coeff>& t, const IntervalBox<Numeric>& box) {
+		return evaluateIn<Numeric>(t, box);
+	}
+
+	template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
+	static Interval<Numeric> evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const IntervalBox<Numeric>& box) {
+		return evaluateIn<Numeric>(p, box);
+	}
+
+	template<typename P, typename Numeric>
+	static Interval<Numeric> evaluate(const FactorizedPolynomial<P>& p, const IntervalBox<Numeric>& box) {
+		return evaluateIn<Numeric>(p, box);
+	}
+
+	template<typename Numeric, typename Coeff>
+	static Interval<Numeric> evaluate(const UnivariatePolynomial<Coeff>& p, const IntervalBox<Numeric>& box) {
+		return evaluateIn<Numeric>(p, box);
+	}
+
+	template<typename PolynomialType, typename Number, class strategy>
+	static Interval<Number> evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const IntervalBox<Number>& box) {
+		return evaluateIn<Number>(mvH, box);
+	}
+
+	template<typename PolynomialType>
+	static Interval<double> evaluate(const CompiledHorner<PolynomialType>& h, const IntervalBox<double>& box) {
+		return h.evaluate(box);
+	}
     
 private:
+	/// The actual implementations, the map only needs to provide count() and at().
+	template<typename Numeric, typename Map>
+	static Interval<Numeric> evaluateIn(const Monomial& m, const Map& map);
+
+	template<typename Numeric, typename Coeff, typename Map>
+	static Interval<Numeric> evaluateIn(const Term<Coeff>& t, const Map& map);
 
+	template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Map>
+	static Interval<Numeric> evaluateIn(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Map& map);
+
+	template<typename Numeric, typename P, typename Map>
+	static Interval<Numeric> evaluateIn(const FactorizedPolynomial<P>& p, const Map& map);
+
+	template<typename Numeric, typename Coeff, typename Map, EnableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluateIn(const UnivariatePolynomial<Coeff>& p, const Map& map);
+
+	template<typename Numeric, typename Coeff, typename Map, DisableIf<std::is_same<Numeric, Coeff>> = dummy>
+	static Interval<Numeric> evaluateIn(const UnivariatePolynomial<Coeff>& p, const Map& map);
+
+	template<typename Number, typename PolynomialType, class strategy, typename Map>
+	static Interval<Number> evaluateIn(const MultivariateHorner<PolynomialType, strategy>& mvH, const Map& map);
 };
 
 
-template<typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Map>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const Monomial& m, const Map& map)
 {
 	Interval<Numeric> result(1);
 	// TODO use iterator.
@@ -71,56 +145,47 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const Monomial& m, const s
 	return result;
 }
 
-template<typename Coeff, typename Numeric, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
-{
-	Interval<Numeric> result(t.coeff());
-	if (t.monomial())
-		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
-	return result;
-}
-
-template<typename Coeff, typename Numeric, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const Term<Coeff>& t, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Map>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const Term<Coeff>& t, const Map& map)
 {
 	Interval<Numeric> result(t.coeff());
 	if (t.monomial())
-		result *= IntervalEvaluation::evaluate( *t.monomial(), map );
+		result *= evaluateIn<Numeric>( *t.monomial(), map );
 	return result;
 }
 
-template<typename Coeff, typename Policy, typename Ordering, typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename Coeff, typename Policy, typename Ordering, typename Map>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const MultivariatePolynomial<Coeff, Policy, Ordering>& p, const Map& map)
 {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	if(p.isZero()) {
 		return Interval<Numeric>(0);
 	} else {
-		Interval<Numeric> result(evaluate(p[0], map)); 
+		Interval<Numeric> result(evaluateIn<Numeric>(p[0], map)); 
 		for (unsigned i = 1; i < p.nrTerms(); ++i) {
             if( result.isInfinite() )
                 return result;
-			result += evaluate(p[i], map);
+			result += evaluateIn<Numeric>(p[i], map);
 		}
 		return result;
 	}
 }
 
-template<typename P, typename Numeric>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const FactorizedPolynomial<P>& p, const std::map<Variable, Interval<Numeric>>& map)
+template<typename Numeric, typename P, typename Map>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const FactorizedPolynomial<P>& p, const Map& map)
 {
     if( !existsFactorization( p ) )
         return Interval<Numeric>( p.coefficient() );
     if( p.factorizedTrivially() )
     {
-        return evaluate( p.polynomial(), map ) * Interval<Numeric>( p.coefficient() );
+        return evaluateIn<Numeric>( p.polynomial(), map ) * Interval<Numeric>( p.coefficient() );
     }
     else
     {
         Interval<Numeric> result( p.coefficient() );
         for( const auto& factor : p.factorization() )
         {
-            Interval<Numeric> factorEvaluated = evaluate( factor.first, map );
+            Interval<Numeric> factorEvaluated = evaluateIn<Numeric>( factor.first, map );
             if( factorEvaluated.isZero() )
                 return factorEvaluated;
             result *= factorEvaluated.pow( factor.second );
@@ -129,8 +194,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const FactorizedPolynomial
     }
 }
 
-template<typename Numeric, typename Coeff, EnableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Map, EnableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const UnivariatePolynomial<Coeff>& p, const Map& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
 	Interval<Numeric> res = Interval<Numeric>::emptyInterval();
@@ -145,15 +210,15 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial
 	return res;
 }
 
-template<typename Numeric, typename Coeff, DisableIf<std::is_same<Numeric, Coeff>>>
-inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial<Coeff>& p, const std::map<Variable, Interval<Numeric>>& map) {
+template<typename Numeric, typename Coeff, typename Map, DisableIf<std::is_same<Numeric, Coeff>>>
+inline Interval<Numeric> IntervalEvaluation::evaluateIn(const UnivariatePolynomial<Coeff>& p, const Map& map) {
 	CARL_LOG_FUNC("carl.core.monomial", p << ", " << map);
 	assert(map.count(p.mainVar()) > 0);
 	Interval<Numeric> res = Interval<Numeric>(carl::constant_zero<Numeric>().get());
 	const Interval<Numeric>& varValue = map.at(p.mainVar());
 	Interval<Numeric> exp(1);
 	for (unsigned i = 0; i <= p.degree(); i++) {
-		res += IntervalEvaluation::evaluate(p.coefficients()[i], map) * exp;
+		res += evaluateIn<Numeric>(p.coefficients()[i], map) * exp;
         if( res.isInfinite() )
             return res;
 		exp = varValue.pow(i+1);
@@ -162,8 +227,8 @@ inline Interval<Numeric> IntervalEvaluation::evaluate(const UnivariatePolynomial
 }
 
 
-template<typename PolynomialType, typename Number, class strategy>
-inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<PolynomialType, strategy>& mvH, const std::map<Variable, Interval<Number>>& map)
+template<typename Number, typename PolynomialType, class strategy, typename Map>
+inline Interval<Number> IntervalEvaluation::evaluateIn(const MultivariateHorner<PolynomialType, strategy>& mvH, const Map& map)
 {
 	#ifdef DEBUG_HORNER
 		std::cout << __func__ << "   " << mvH << std::endl;
@@ -175,7 +240,7 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 	if (mvH.getVariable() != Variable::NO_VARIABLE){
 		assert(map.count(mvH.getVariable()) > 0);
 		Interval<Number> res = Interval<Number>::emptyInterval();
-		const Interval<Number> varValue = map.find(mvH.getVariable())->second;
+		const Interval<Number> varValue = map.at(mvH.getVariable());
 
 		
 
@@ -188,19 +253,19 @@ inline Interval<Number> IntervalEvaluation::evaluate(const MultivariateHorner<Po
 		//Case 2: dependent part contains a Horner Scheme
 		else if (mvH.getDependent() && !mvH.getIndependent())
 		{
-			result = varValue.pow(mvH.getExponent()) * evaluate(*mvH.getDependent(), map) + Interval<Number> (mvH.getIndepConstant());
+			result = varValue.pow(mvH.getExponent()) * evaluateIn<Number>(*mvH.getDependent(), map) + Interval<Number> (mvH.getIndepConstant());
 			return result;
 		}
 		//Case 3: independent part contains a Horner Scheme
 		else if (!mvH.getDependent() && mvH.getIndependent())
 		{
-			result = varValue.pow(mvH.getExponent()) * Interval<Number> (mvH.getDepConstant()) +  evaluate(*mvH.getIndependent(), map);
+			result = varValue.pow(mvH.getExponent()) * Interval<Number> (mvH.getDepConstant()) +  evaluateIn<Number>(*mvH.getIndependent(), map);
 			return result;
 		}
 		//Case 4: both independent part and dependent part 
 		else if (mvH.getDependent()  && mvH.getIndependent())
 		{
-			result = varValue.pow(mvH.getExponent()) * evaluate(*mvH.getDependent(), map) + evaluate(*mvH.getIndependent(), map);
+			result = varValue.pow(mvH.getExponent()) * evaluateIn<Number>(*mvH.getDependent(), map) + evaluateIn<Number>(*mvH.getIndependent(), map);
 			return result;
 		}
 	}
@@ -0,0 +1,259 @@
+/**
+ * @file NativeInterval.h
+ *
+ * A lightweight interval over native doubles for performance critical code like interval constraint propagation.
+ *
+ * In contrast to Interval<double>, it does neither rely on boost::numeric::interval nor switch the rounding mode of the FPU.
+ * All operations are performed with the default rounding to nearest and the results are widened outwards by one ulp.
+ * As the result of a single operation rounded to nearest is within one ulp of the exact result, this yields a valid enclosure.
+ * Bounds are always closed, unbounded intervals use infinity as bound and the empty interval is represented by NaN bounds.
+ */
+
+#pragma once
+
+#include "Interval.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace carl {
+
+namespace native_interval {
+	/// Returns the next larger double, infinity and NaN are kept.
+	inline double nextUp(double d) {
+		if (!(d < std::numeric_limits<double>::infinity())) return d;
+		if (d == 0) return std::numeric_limits<double>::denorm_min();
+		std::uint64_t bits;
+		std::memcpy(&bits, &d, sizeof(d));
+		if (d > 0) bits++;
+		else bits--;
+		std::memcpy(&d, &bits, sizeof(d));
+		return d;
+	}
+	/// Returns the next smaller double, infinity and NaN are kept.
+	inline double nextDown(double d) {
+		return -nextUp(-d);
+	}
+	/// Raises a non-negative number to the given power, rounded downwards.
+	inline double powDown(double base, uint exp) {
+		double res = 1;
+		while (exp > 0) {
+			if (exp & 1) res = std::max(nextDown(res * base), 0.0);
+			exp >>= 1;
+			if (exp > 0) base = std::max(nextDown(base * base), 0.0);
+		}
+		return res;
+	}
+	/// Raises a non-negative number to the given power, rounded upwards.
+	inline double powUp(double base, uint exp) {
+		double res = 1;
+		while (exp > 0) {
+			if (exp & 1) res = nextUp(res * base);
+			exp >>= 1;
+			if (exp > 0) base = nextUp(base * base);
+		}
+		return res;
+	}
+}
+
+/**
+ * A closed interval over double.
+ */
+class NativeInterval {
+private:
+	double mLower;
+	double mUpper;
+
+	static constexpr double infty() {
+		return std::numeric_limits<double>::infinity();
+	}
+	static constexpr double nan() {
+		return std::numeric_limits<double>::quiet_NaN();
+	}
+public:
+	/// Constructs the point interval [0,0].
+	NativeInterval(): mLower(0), mUpper(0) {}
+	/// Constructs the point interval [n,n].
+	explicit NativeInterval(double n): mLower(n), mUpper(n) {}
+	/// Constructs the interval [lower,upper].
+	NativeInterval(double lower, double upper): mLower(lower), mUpper(upper) {}
+	/**
+	 * Converts an Interval<double>.
+	 * Strict bounds are relaxed to weak bounds, hence the result may be slightly larger.
+	 */
+	explicit NativeInterval(const Interval<double>& i) {
+		if (i.isEmpty()) {
+			mLower = nan();
+			mUpper = nan();
+			return;
+		}
+		mLower = (i.lowerBoundType() == BoundType::INFTY) ? -infty() : i.lower();
+		mUpper = (i.upperBoundType() == BoundType::INFTY) ? infty() : i.upper();
+	}
+
+	static NativeInterval emptyInterval() {
+		return NativeInterval(nan(), nan());
+	}
+	static NativeInterval unboundedInterval() {
+		return NativeInterval(-infty(), infty());
+	}
+
+	/// Converts to an Interval<double> with weak or infinite bounds.
+	Interval<double> toInterval() const {
+		if (isEmpty()) return Interval<double>::emptyInterval();
+		return Interval<double>(
+			mLower, std::isinf(mLower) ? BoundType::INFTY : BoundType::WEAK,
+			mUpper, std::isinf(mUpper) ? BoundType::INFTY : BoundType::WEAK
+		);
+	}
+
+	double lower() const {
+		return mLower;
+	}
+	double upper() const {
+		return mUpper;
+	}
+	bool isEmpty() const {
+		return !(mLower <= mUpper);
+	}
+	bool isUnbounded() const {
+		return mLower == -infty() && mUpper == infty();
+	}
+	bool isPointInterval() const {
+		return mLower == mUpper;
+	}
+	bool isZero() const {
+		return mLower == 0 && mUpper == 0;
+	}
+	bool contains(double n) const {
+		return mLower <= n && n <= mUpper;
+	}
+	bool containsZero() const {
+		return contains(0);
+	}
+	bool isPositive() const {
+		return mLower > 0;
+	}
+	bool isNegative() const {
+		return mUpper < 0;
+	}
+	double diameter() const {
+		return native_interval::nextUp(mUpper - mLower);
+	}
+	double center() const {
+		return mLower / 2 + mUpper / 2;
+	}
+
+	NativeInterval operator-() const {
+		return NativeInterval(-mUpper, -mLower);
+	}
+
+	NativeInterval& operator+=(const NativeInterval& rhs) {
+		mLower = native_interval::nextDown(mLower + rhs.mLower);
+		mUpper = native_interval::nextUp(mUpper + rhs.mUpper);
+		return *this;
+	}
+	NativeInterval& operator-=(const NativeInterval& rhs) {
+		mLower = native_interval::nextDown(mLower - rhs.mUpper);
+		mUpper = native_interval::nextUp(mUpper - rhs.mLower);
+		return *this;
+	}
+	/**
+	 * Multiplies all four combinations of bounds and takes the extremal values.
+	 * A product of zero and infinity yields NaN, which is ignored by fmin and fmax.
+	 * This is correct, as such a bound product is never the only candidate for an extremal value unless one factor is zero.
+	 */
+	NativeInterval& operator*=(const NativeInterval& rhs) {
+		if (isEmpty() || rhs.isEmpty()) return *this = emptyInterval();
+		if (isZero() || rhs.isZero()) return *this = NativeInterval();
+		double ll = mLower * rhs.mLower;
+		double lu = mLower * rhs.mUpper;
+		double ul = mUpper * rhs.mLower;
+		double uu = mUpper * rhs.mUpper;
+		mLower = native_interval::nextDown(std::fmin(std::fmin(ll, lu), std::fmin(ul, uu)));
+		mUpper = native_interval::nextUp(std::fmax(std::fmax(ll, lu), std::fmax(ul, uu)));
+		return *this;
+	}
+	/**
+	 * Divides by the given interval.
+	 * If the divisor contains zero, the result is unbounded (or [0,0] if this interval is [0,0]).
+	 */
+	NativeInterval& operator/=(const NativeInterval& rhs) {
+		if (isEmpty() || rhs.isEmpty()) return *this = emptyInterval();
+		if (rhs.containsZero()) {
+			if (isZero()) return *this;
+			return *this = unboundedInterval();
+		}
+		double ll = mLower / rhs.mLower;
+		double lu = mLower / rhs.mUpper;
+		double ul = mUpper / rhs.mLower;
+		double uu = mUpper / rhs.mUpper;
+		mLower = native_interval::nextDown(std::fmin(std::fmin(ll, lu), std::fmin(ul, uu)));
+		mUpper = native_interval::nextUp(std::fmax(std::fmax(ll, lu), std::fmax(ul, uu)));
+		return *this;
+	}
+
+	/// Raises the interval to the given power.
+	NativeInterval pow(uint exp) const {
+		using namespace native_interval;
+		if (isEmpty()) return *this;
+		if (exp == 0) return NativeInterval(1);
+		if (mLower >= 0) return NativeInterval(powDown(mLower, exp), powUp(mUpper, exp));
+		if (exp % 2 == 1) {
+			double lower = -powUp(-mLower, exp);
+			double upper = (mUpper >= 0) ? powUp(mUpper, exp) : -powDown(-mUpper, exp);
+			return NativeInterval(lower, upper);
+		}
+		if (mUpper <= 0) return NativeInterval(powDown(-mUpper, exp), powUp(-mLower, exp));
+		return NativeInterval(0, powUp(std::max(-mLower, mUpper), exp));
+	}
+
+	/// Returns the intersection of both intervals.
+	NativeInterval intersect(const NativeInterval& rhs) const {
+		NativeInterval res(std::max(mLower, rhs.mLower), std::min(mUpper, rhs.mUpper));
+		if (res.isEmpty()) return emptyInterval();
+		return res;
+	}
+	/// Returns the smallest interval containing both intervals.
+	NativeInterval convexHull(const NativeInterval& rhs) const {
+		if (isEmpty()) return rhs;
+		if (rhs.isEmpty()) return *this;
+		return NativeInterval(std::min(mLower, rhs.mLower), std::max(mUpper, rhs.mUpper));
+	}
+};
+
+inline NativeInterval operator+(NativeInterval lhs, const NativeInterval& rhs) {
+	return lhs += rhs;
+}
+inline NativeInterval operator-(NativeInterval lhs, const NativeInterval& rhs) {
+	return lhs -= rhs;
+}
+inline NativeInterval operator*(NativeInterval lhs, const NativeInterval& rhs) {
+	return lhs *= rhs;
+}
+inline NativeInterval operator/(NativeInterval lhs, const NativeInterval& rhs) {
+	return lhs /= rhs;
+}
+inline NativeInterval pow(const NativeInterval& i, uint exp) {
+	return i.pow(exp);
+}
+
+/// Checks whether both intervals are equal, all empty intervals are considered equal.
+inline bool operator==(const NativeInterval& lhs, const NativeInterval& rhs) {
+	if (lhs.isEmpty() || rhs.isEmpty()) return lhs.isEmpty() && rhs.isEmpty();
+	return lhs.lower() == rhs.lower() && lhs.upper() == rhs.upper();
+}
+inline bool operator!=(const NativeInterval& lhs, const NativeInterval& rhs) {
+	return !(lhs == rhs);
+}
+
+inline std::ostream& operator<<(std::ostream& os, const NativeInterval& i) {
+	if (i.isEmpty()) return os << "(empty)";
+	return os << "[" << i.lower() << ", " << i.upper() << "]";
+}
+
+}
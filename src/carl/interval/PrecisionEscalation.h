@@ -0,0 +1,188 @@
+/**
+ * @file PrecisionEscalation.h
+ *
+ * Evaluation of polynomials with adaptive precision.
+ *
+ * A polynomial is evaluated over a rational box in interval arithmetic with some fixed precision.
+ * If the enclosure does not decide the sign of the polynomial, the precision is doubled and the evaluation is repeated,
+ * until the sign is decided or a maximum precision is reached.
+ * This serves both the sign determination at (algebraic) points given by small boxes and the refinement of roots.
+ */
+
+#pragma once
+
+#include "DyadicInterval.h"
+#include "Interval.h"
+#include "../core/Sign.h"
+#include "../core/Variable.h"
+
+#include <boost/optional.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <map>
+#include <vector>
+
+namespace carl {
+
+/**
+ * Outward conversion of rational bounds to an interval backend with a given precision.
+ * Specializations exist for Dyadic and, if available, for FLOAT_T<mpfr_t>.
+ * Scope makes the precision effective for the arithmetic of the backend in the current thread while it exists,
+ * if the backend does not already take it from the operands.
+ */
+template<typename Number>
+struct IntervalPrecision;
+
+template<>
+struct IntervalPrecision<Dyadic> {
+	/// Sets the default precision of the current thread, which is used to round the results of interval operations, and restores the previous one on destruction.
+	struct Scope {
+		std::size_t mPrevious;
+		explicit Scope(std::size_t precision): mPrevious(Dyadic::precision()) {
+			Dyadic::setPrecision(precision);
+		}
+		~Scope() {
+			Dyadic::setPrecision(mPrevious);
+		}
+	};
+	static Interval<Dyadic> enclose(const mpq_class& lower, const mpq_class& upper, std::size_t precision) {
+		return Interval<Dyadic>(Dyadic::roundDown(lower, precision), BoundType::WEAK, Dyadic::roundUp(upper, precision), BoundType::WEAK);
+	}
+};
+
+#ifdef USE_MPFR_FLOAT
+template<>
+struct IntervalPrecision<FLOAT_T<mpfr_t>> {
+	/**
+	 * Does not change the global default precision.
+	 * The results of interval operations obtain the largest precision of their operands, see rounding_mpfr.tpp,
+	 * hence enclosing all operands with the given precision suffices.
+	 */
+	struct Scope {
+		explicit Scope(std::size_t /*precision*/) {}
+	};
+	static Interval<FLOAT_T<mpfr_t>> enclose(const mpq_class& lower, const mpq_class& upper, std::size_t precision) {
+		mpfr_t l;
+		mpfr_t u;
+		mpfr_init2(l, mpfr_prec_t(precision));
+		mpfr_init2(u, mpfr_prec_t(precision));
+		mpfr_set_q(l, lower.get_mpq_t(), MPFR_RNDD);
+		mpfr_set_q(u, upper.get_mpq_t(), MPFR_RNDU);
+		Interval<FLOAT_T<mpfr_t>> res(FLOAT_T<mpfr_t>(l), BoundType::WEAK, FLOAT_T<mpfr_t>(u), BoundType::WEAK);
+		mpfr_clear(l);
+		mpfr_clear(u);
+		return res;
+	}
+};
+#endif
+
+/**
+ * Evaluates a fixed polynomial with increasing precision until its sign is decided.
+ * @tparam Number Interval backend with a variable precision, i.e. Dyadic or FLOAT_T<mpfr_t>.
+ * @tparam Poly Polynomial type with coefficients of type mpq_class.
+ */
+template<typename Number, typename Poly>
+class PrecisionEscalation {
+public:
+	using Rational = typename Poly::CoeffType;
+	struct Settings {
+		/// Precision of the first evaluation.
+		std::size_t initialPrecision = 53;
+		/// Maximum precision, the evaluation stops after the first evaluation with at least this precision.
+		std::size_t maxPrecision = 4096;
+	};
+private:
+	Poly mPolynomial;
+	Settings mSettings;
+	/// Precision of the last evaluation.
+	std::size_t mPrecision = 0;
+	/// Number of evaluations of the last call to sign().
+	std::size_t mEvaluations = 0;
+
+	Interval<Number> evaluateTerms(const std::map<Variable, Interval<Rational>>& box, std::size_t precision) const {
+		std::map<Variable, Interval<Number>> values;
+		for (const auto& term: mPolynomial) {
+			if (!term.monomial()) continue;
+			for (const auto& ve: *term.monomial()) {
+				if (values.count(ve.first) > 0) continue;
+				const Interval<Rational>& i = box.at(ve.first);
+				assert(!i.isEmpty() && !i.isUnbounded());
+				values.emplace(ve.first, IntervalPrecision<Number>::enclose(i.lower(), i.upper(), precision));
+			}
+		}
+		Interval<Number> result(Number(0));
+		for (const auto& term: mPolynomial) {
+			Interval<Number> t = IntervalPrecision<Number>::enclose(term.coeff(), term.coeff(), precision);
+			if (term.monomial()) {
+				for (const auto& ve: *term.monomial()) {
+					t *= values.at(ve.first).pow(ve.second);
+				}
+			}
+			result += t;
+		}
+		return result;
+	}
+
+	static boost::optional<Sign> decide(const Interval<Number>& i) {
+		if (i.isPositive()) return Sign::POSITIVE;
+		if (i.isNegative()) return Sign::NEGATIVE;
+		if (i.isZero()) return Sign::ZERO;
+		return boost::none;
+	}
+public:
+	explicit PrecisionEscalation(const Poly& p, const Settings& settings = Settings()):
+		mPolynomial(p),
+		mSettings(settings)
+	{
+		assert(mSettings.initialPrecision > 0);
+	}
+
+	Settings& settings() {
+		return mSettings;
+	}
+	/// Precision of the last evaluation.
+	std::size_t precision() const {
+		return mPrecision;
+	}
+	/// Number of evaluations of the last call to sign().
+	std::size_t evaluations() const {
+		return mEvaluations;
+	}
+
+	/**
+	 * Evaluates the polynomial over the box with the given precision.
+	 * @param box Bounded intervals for all variables of the polynomial.
+	 * @param precision Precision of the backend.
+	 * @return An enclosure of the range of the polynomial over the box.
+	 */
+	Interval<Number> evaluate(const std::map<Variable, Interval<Rational>>& box, std::size_t precision) {
+		typename IntervalPrecision<Number>::Scope scope(precision);
+		mPrecision = precision;
+		return evaluateTerms(box, precision);
+	}
+
+	/**
+	 * Determines the sign of the polynomial on the box, doubling the precision until the enclosure decides it.
+	 * @param box Bounded intervals for all variables of the polynomial.
+	 * @return The sign, or boost::none if the maximum precision did not suffice.
+	 * This is in particular the case if the polynomial vanishes somewhere on the box, unless it is a point that is represented exactly.
+	 */
+	boost::optional<Sign> sign(const std::map<Variable, Interval<Rational>>& box) {
+		mEvaluations = 0;
+		for (std::size_t precision = mSettings.initialPrecision; ; precision *= 2) {
+			precision = std::min(precision, std::max(mSettings.maxPrecision, mSettings.initialPrecision));
+			mEvaluations++;
+			auto res = decide(evaluate(box, precision));
+			if (res || precision >= mSettings.maxPrecision) return res;
+		}
+	}
+	/// Determines the sign of the polynomial at the given point, see sign() for boxes.
+	boost::optional<Sign> sign(const std::map<Variable, Rational>& point) {
+		std::map<Variable, Interval<Rational>> box;
+		for (const auto& vr: point) box.emplace(vr.first, Interval<Rational>(vr.second));
+		return sign(box);
+	}
+};
+
+}
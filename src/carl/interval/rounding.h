@@ -214,4 +214,6 @@ namespace carl
     };
 }
 
-#include "rounding/rounding_float_t.tpp"
\ No newline at end of file
+#include "rounding/rounding_float_t.tpp"
+#include "rounding/rounding_mpfr.tpp"
+#include "rounding/rounding_dyadic.tpp"
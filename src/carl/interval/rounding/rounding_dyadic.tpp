@@ -0,0 +1,112 @@
+/*
+ * This file contains the rounding policies needed from the boost interval class
+ * for the Dyadic type used in carl.
+ *
+ * Every operation is carried out exactly (or with a sufficiently large intermediate precision)
+ * and the result is rounded outwards to Dyadic::precision() bits, which bounds the size of the endpoints.
+ * Only the algebraic operations are supported.
+ *
+ * @file   rounding_dyadic.tpp
+ */
+
+#pragma once
+#include "../../numbers/numbers.h"
+
+namespace carl
+{
+    template<>
+    struct rounding<Dyadic>
+    {
+    private:
+        static Dyadic sqrt(const Dyadic& _val, bool _up)
+        {
+            if(_val <= 0)
+                return Dyadic(0);
+            std::size_t precision = Dyadic::precision();
+            // Write _val = m * 2^(2k) with an even exponent and at least 2 * precision bits in m.
+            sint shift = sint(2 * precision + 2) - sint(_val.bitSize());
+            if (shift < 0) shift = 0;
+            if ((_val.exponent() - shift) % 2 != 0) shift++;
+            mpz_class m;
+            mpz_mul_2exp(m.get_mpz_t(), _val.mantissa().get_mpz_t(), mp_bitcnt_t(shift));
+            mpz_class root;
+            mpz_sqrt(root.get_mpz_t(), m.get_mpz_t());
+            if (_up && root * root != m) root += 1;
+            return Dyadic(root, (_val.exponent() - shift) / 2).round(precision, _up);
+        }
+    public:
+        Dyadic add_down(const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs + _rhs).round(Dyadic::precision(), false);
+        }
+
+        Dyadic add_up(const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs + _rhs).round(Dyadic::precision(), true);
+        }
+
+        Dyadic sub_down(const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs - _rhs).round(Dyadic::precision(), false);
+        }
+
+        Dyadic sub_up  (const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs - _rhs).round(Dyadic::precision(), true);
+        }
+
+        Dyadic mul_down(const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs * _rhs).round(Dyadic::precision(), false);
+        }
+
+        Dyadic mul_up  (const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞][-∞;+∞]
+        {
+            return (_lhs * _rhs).round(Dyadic::precision(), true);
+        }
+
+        Dyadic div_down(const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞]([-∞;+∞]-{0})
+        {
+            return Dyadic::divide(_lhs, _rhs, Dyadic::precision(), false);
+        }
+
+        Dyadic div_up  (const Dyadic& _lhs, const Dyadic& _rhs) // [-∞;+∞]([-∞;+∞]-{0})
+        {
+            return Dyadic::divide(_lhs, _rhs, Dyadic::precision(), true);
+        }
+
+        Dyadic sqrt_down(const Dyadic& _val)   // ]0;+∞]
+        {
+            return sqrt(_val, false);
+        }
+        Dyadic sqrt_up  (const Dyadic& _val)   // ]0;+∞]
+        {
+            return sqrt(_val, true);
+        }
+        Dyadic median(const Dyadic& _val1, const Dyadic& _val2)   // [-∞;+∞][-∞;+∞]
+        {
+            // Halving is exact.
+            return (_val1 + _val2) * Dyadic(mpz_class(1), -1);
+        }
+        Dyadic int_down(const Dyadic& _val)    // [-∞;+∞]
+        {
+            return Dyadic(carl::floor(_val));
+        }
+        Dyadic int_up  (const Dyadic& _val)    // [-∞;+∞]
+        {
+            return Dyadic(carl::ceil(_val));
+        }
+        // conversion functions
+        template<typename U>
+        Dyadic conv_down(U _val)
+        {
+            return Dyadic(_val).round(Dyadic::precision(), false);
+        }
+
+        template<typename U>
+        Dyadic conv_up(U _val)
+        {
+            return Dyadic(_val).round(Dyadic::precision(), true);
+        }
+    };
+}
@@ -0,0 +1,146 @@
+/*
+ * This file contains the rounding policies needed from the boost interval class
+ * for the FLOAT_T<mpfr_t> type used in carl.
+ *
+ * Contrary to the generic policy for FLOAT_T, results are computed directly by mpfr with MPFR_RNDD or MPFR_RNDU
+ * and obtain the largest precision of the operands and the default precision.
+ * Hence, raising FLOAT_T<mpfr_t>::defaultPrecision() refines all subsequent interval operations.
+ *
+ * @file   rounding_mpfr.tpp
+ */
+
+#pragma once
+#include "../../numbers/numbers.h"
+
+#ifdef USE_MPFR_FLOAT
+
+#include <algorithm>
+
+namespace carl
+{
+    template<>
+    struct rounding<FLOAT_T<mpfr_t> >
+    {
+    private:
+        using Float = FLOAT_T<mpfr_t>;
+        using UnaryFunction = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_rnd_t);
+        using BinaryFunction = int (*)(mpfr_ptr, mpfr_srcptr, mpfr_srcptr, mpfr_rnd_t);
+
+        static mpfr_prec_t precision(const Float& _val)
+        {
+            return std::max(mpfr_get_prec(_val.value()), mpfr_prec_t(Float::defaultPrecision()));
+        }
+
+        static Float apply(UnaryFunction _f, const Float& _val, mpfr_rnd_t _rnd)
+        {
+            mpfr_t result;
+            mpfr_init2(result, precision(_val));
+            _f(result, _val.value(), _rnd);
+            Float res(result);
+            mpfr_clear(result);
+            return res;
+        }
+
+        static Float apply(BinaryFunction _f, const Float& _lhs, const Float& _rhs, mpfr_rnd_t _rnd)
+        {
+            mpfr_t result;
+            mpfr_init2(result, std::max(precision(_lhs), precision(_rhs)));
+            _f(result, _lhs.value(), _rhs.value(), _rnd);
+            Float res(result);
+            mpfr_clear(result);
+            return res;
+        }
+    public:
+        // mathematical operations
+        Float add_down(const Float& _lhs, const Float& _rhs) { return apply(mpfr_add, _lhs, _rhs, MPFR_RNDD); }
+        Float add_up  (const Float& _lhs, const Float& _rhs) { return apply(mpfr_add, _lhs, _rhs, MPFR_RNDU); }
+        Float sub_down(const Float& _lhs, const Float& _rhs) { return apply(mpfr_sub, _lhs, _rhs, MPFR_RNDD); }
+        Float sub_up  (const Float& _lhs, const Float& _rhs) { return apply(mpfr_sub, _lhs, _rhs, MPFR_RNDU); }
+        Float mul_down(const Float& _lhs, const Float& _rhs) { return apply(mpfr_mul, _lhs, _rhs, MPFR_RNDD); }
+        Float mul_up  (const Float& _lhs, const Float& _rhs) { return apply(mpfr_mul, _lhs, _rhs, MPFR_RNDU); }
+        Float div_down(const Float& _lhs, const Float& _rhs) { return apply(mpfr_div, _lhs, _rhs, MPFR_RNDD); }
+        Float div_up  (const Float& _lhs, const Float& _rhs) { return apply(mpfr_div, _lhs, _rhs, MPFR_RNDU); }
+
+        Float sqrt_down(const Float& _val)
+        {
+            if (mpfr_sgn(_val.value()) <= 0) return Float(0);
+            return apply(mpfr_sqrt, _val, MPFR_RNDD);
+        }
+        Float sqrt_up  (const Float& _val)
+        {
+            if (mpfr_sgn(_val.value()) <= 0) return Float(0);
+            return apply(mpfr_sqrt, _val, MPFR_RNDU);
+        }
+        Float exp_down  (const Float& _val) { return apply(mpfr_exp, _val, MPFR_RNDD); }
+        Float exp_up    (const Float& _val) { return apply(mpfr_exp, _val, MPFR_RNDU); }
+        Float log_down  (const Float& _val) { return apply(mpfr_log, _val, MPFR_RNDD); }
+        Float log_up    (const Float& _val) { return apply(mpfr_log, _val, MPFR_RNDU); }
+        Float sin_down  (const Float& _val) { return apply(mpfr_sin, _val, MPFR_RNDD); }
+        Float sin_up    (const Float& _val) { return apply(mpfr_sin, _val, MPFR_RNDU); }
+        Float cos_down  (const Float& _val) { return apply(mpfr_cos, _val, MPFR_RNDD); }
+        Float cos_up    (const Float& _val) { return apply(mpfr_cos, _val, MPFR_RNDU); }
+        Float tan_down  (const Float& _val) { return apply(mpfr_tan, _val, MPFR_RNDD); }
+        Float tan_up    (const Float& _val) { return apply(mpfr_tan, _val, MPFR_RNDU); }
+        Float asin_down (const Float& _val) { return apply(mpfr_asin, _val, MPFR_RNDD); }
+        Float asin_up   (const Float& _val) { return apply(mpfr_asin, _val, MPFR_RNDU); }
+        Float acos_down (const Float& _val) { return apply(mpfr_acos, _val, MPFR_RNDD); }
+        Float acos_up   (const Float& _val) { return apply(mpfr_acos, _val, MPFR_RNDU); }
+        Float atan_down (const Float& _val) { return apply(mpfr_atan, _val, MPFR_RNDD); }
+        Float atan_up   (const Float& _val) { return apply(mpfr_atan, _val, MPFR_RNDU); }
+        Float sinh_down (const Float& _val) { return apply(mpfr_sinh, _val, MPFR_RNDD); }
+        Float sinh_up   (const Float& _val) { return apply(mpfr_sinh, _val, MPFR_RNDU); }
+        Float cosh_down (const Float& _val) { return apply(mpfr_cosh, _val, MPFR_RNDD); }
+        Float cosh_up   (const Float& _val) { return apply(mpfr_cosh, _val, MPFR_RNDU); }
+        Float tanh_down (const Float& _val) { return apply(mpfr_tanh, _val, MPFR_RNDD); }
+        Float tanh_up   (const Float& _val) { return apply(mpfr_tanh, _val, MPFR_RNDU); }
+        Float asinh_down(const Float& _val) { return apply(mpfr_asinh, _val, MPFR_RNDD); }
+        Float asinh_up  (const Float& _val) { return apply(mpfr_asinh, _val, MPFR_RNDU); }
+        Float acosh_down(const Float& _val) { return apply(mpfr_acosh, _val, MPFR_RNDD); }
+        Float acosh_up  (const Float& _val) { return apply(mpfr_acosh, _val, MPFR_RNDU); }
+        Float atanh_down(const Float& _val) { return apply(mpfr_atanh, _val, MPFR_RNDD); }
+        Float atanh_up  (const Float& _val) { return apply(mpfr_atanh, _val, MPFR_RNDU); }
+
+        Float median(const Float& _val1, const Float& _val2)
+        {
+            Float sum = apply(mpfr_add, _val1, _val2, MPFR_RNDN);
+            mpfr_t result;
+            mpfr_init2(result, mpfr_get_prec(sum.value()));
+            mpfr_div_2ui(result, sum.value(), 1, MPFR_RNDN);
+            Float res(result);
+            mpfr_clear(result);
+            return res;
+        }
+        Float int_down(const Float& _val)
+        {
+            mpfr_t result;
+            mpfr_init2(result, precision(_val));
+            mpfr_floor(result, _val.value());
+            Float res(result);
+            mpfr_clear(result);
+            return res;
+        }
+        Float int_up  (const Float& _val)
+        {
+            mpfr_t result;
+            mpfr_init2(result, precision(_val));
+            mpfr_ceil(result, _val.value());
+            Float res(result);
+            mpfr_clear(result);
+            return res;
+        }
+        // conversion functions
+        template<typename U>
+        Float conv_down(U _val)
+        {
+            return Float(_val, CARL_RND::D );
+        }
+
+        template<typename U>
+        Float conv_up(U _val)
+        {
+            return Float(_val, CARL_RND::U );
+        }
+    };
+}
+
+#endif
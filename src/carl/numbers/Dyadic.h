@@ -0,0 +1,311 @@
+/**
+ * @file Dyadic.h
+ *
+ * Dyadic rationals, i.e. numbers of the form m * 2^e for integers m and e.
+ *
+ * Addition, subtraction and multiplication of dyadic numbers are exact, but the size of the mantissa grows with every operation.
+ * Contrary to rationals, dyadic numbers can be rounded to a fixed number of mantissa bits in a well-defined direction,
+ * which makes them a good choice for interval endpoints that must stay small.
+ */
+
+#pragma once
+
+#include "numbers.h"
+#include "../util/hash.h"
+
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+
+namespace carl
+{
+
+class Dyadic
+{
+private:
+	/// Mantissa, which is odd unless the number is zero.
+	mpz_class mMantissa;
+	/// Exponent, which is zero if the number is zero.
+	sint mExponent = 0;
+
+	/// The default precision is thread-local, such that threads can evaluate with different precisions.
+	static std::size_t& defaultPrecision() {
+		thread_local std::size_t precision = 64;
+		return precision;
+	}
+
+	/// Removes trailing zeros from the mantissa.
+	void normalize() {
+		if (mMantissa == 0) {
+			mExponent = 0;
+			return;
+		}
+		mp_bitcnt_t zeros = mpz_scan1(mMantissa.get_mpz_t(), 0);
+		if (zeros > 0) {
+			mpz_fdiv_q_2exp(mMantissa.get_mpz_t(), mMantissa.get_mpz_t(), zeros);
+			mExponent += sint(zeros);
+		}
+	}
+
+	/// Returns m * 2^shift for shift >= 0.
+	static mpz_class shifted(const mpz_class& m, sint shift) {
+		assert(shift >= 0);
+		mpz_class res;
+		mpz_mul_2exp(res.get_mpz_t(), m.get_mpz_t(), mp_bitcnt_t(shift));
+		return res;
+	}
+
+	/// Returns floor (or ceil, if up is set) of num / den as a dyadic number with the given number of bits.
+	static Dyadic divide(const mpz_class& num, const mpz_class& den, std::size_t precision, bool up) {
+		assert(den != 0);
+		if (num == 0) return Dyadic();
+		// Choose s such that the quotient num * 2^s / den has at least precision bits.
+		sint s = sint(precision) + 1 - sint(mpz_sizeinbase(num.get_mpz_t(), 2)) + sint(mpz_sizeinbase(den.get_mpz_t(), 2));
+		mpz_class n = num;
+		mpz_class d = den;
+		if (s >= 0) n = shifted(n, s);
+		else d = shifted(d, -s);
+		if (d < 0) {
+			n = -n;
+			d = -d;
+		}
+		Dyadic res;
+		if (up) mpz_cdiv_q(res.mMantissa.get_mpz_t(), n.get_mpz_t(), d.get_mpz_t());
+		else mpz_fdiv_q(res.mMantissa.get_mpz_t(), n.get_mpz_t(), d.get_mpz_t());
+		res.mExponent = -s;
+		res.normalize();
+		return res.round(precision, up);
+	}
+public:
+	Dyadic() = default;
+	Dyadic(int n): mMantissa(n) { normalize(); } // NOLINT
+	Dyadic(long n): mMantissa(n) { normalize(); } // NOLINT
+	Dyadic(const mpz_class& n): mMantissa(n) { normalize(); } // NOLINT
+	/// Creates m * 2^e.
+	Dyadic(const mpz_class& m, sint e): mMantissa(m), mExponent(e) { normalize(); }
+	/// Every finite double is a dyadic number, hence the conversion is exact.
+	explicit Dyadic(double d) {
+		assert(std::isfinite(d));
+		int e = 0;
+		double f = std::frexp(d, &e);
+		mMantissa = mpz_class(std::ldexp(f, 53));
+		mExponent = sint(e) - 53;
+		normalize();
+	}
+
+	/// Returns the number of mantissa bits used for rounding by default in the current thread.
+	static std::size_t precision() {
+		return defaultPrecision();
+	}
+	/// Sets the number of mantissa bits used for rounding by default in the current thread.
+	static void setPrecision(std::size_t precision) {
+		assert(precision > 0);
+		defaultPrecision() = precision;
+	}
+
+	/// Returns the largest dyadic number with the given number of bits that is at most q.
+	static Dyadic roundDown(const mpq_class& q, std::size_t precision = Dyadic::precision()) {
+		return divide(q.get_num(), q.get_den(), precision, false);
+	}
+	/// Returns the smallest dyadic number with the given number of bits that is at least q.
+	static Dyadic roundUp(const mpq_class& q, std::size_t precision = Dyadic::precision()) {
+		return divide(q.get_num(), q.get_den(), precision, true);
+	}
+	/// Returns lhs / rhs rounded down (or up) to the given number of bits.
+	static Dyadic divide(const Dyadic& lhs, const Dyadic& rhs, std::size_t precision, bool up) {
+		Dyadic res = divide(lhs.mMantissa, rhs.mMantissa, precision, up);
+		res.mExponent += lhs.mExponent - rhs.mExponent;
+		if (res.mMantissa == 0) res.mExponent = 0;
+		return res;
+	}
+
+	const mpz_class& mantissa() const {
+		return mMantissa;
+	}
+	sint exponent() const {
+		return mExponent;
+	}
+	/// Number of bits of the mantissa.
+	std::size_t bitSize() const {
+		if (mMantissa == 0) return 0;
+		return mpz_sizeinbase(mMantissa.get_mpz_t(), 2);
+	}
+
+	/**
+	 * Rounds to a number whose mantissa has at most the given number of bits.
+	 * @param precision Number of bits.
+	 * @param up Round towards positive infinity if set, towards negative infinity otherwise.
+	 */
+	Dyadic round(std::size_t precision, bool up) const {
+		assert(precision > 0);
+		std::size_t bits = bitSize();
+		if (bits <= precision) return *this;
+		mp_bitcnt_t k = bits - precision;
+		Dyadic res;
+		if (up) mpz_cdiv_q_2exp(res.mMantissa.get_mpz_t(), mMantissa.get_mpz_t(), k);
+		else mpz_fdiv_q_2exp(res.mMantissa.get_mpz_t(), mMantissa.get_mpz_t(), k);
+		res.mExponent = mExponent + sint(k);
+		res.normalize();
+		return res;
+	}
+
+	/// Converts to an exact rational.
+	mpq_class toRational() const {
+		if (mExponent >= 0) return mpq_class(shifted(mMantissa, mExponent));
+		mpq_class res(mMantissa, shifted(mpz_class(1), -mExponent));
+		res.canonicalize();
+		return res;
+	}
+	/**
+	 * Converts to the nearest double, where ties are rounded to an even mantissa.
+	 * Only results in the subnormal range may be rounded twice.
+	 */
+	double toDouble() const {
+		const std::size_t digits = std::numeric_limits<double>::digits;
+		std::size_t bits = bitSize();
+		if (bits <= digits) return std::ldexp(mMantissa.get_d(), int(mExponent));
+		mp_bitcnt_t k = bits - digits;
+		mpz_class m = abs(mMantissa);
+		mpz_class q;
+		mpz_fdiv_q_2exp(q.get_mpz_t(), m.get_mpz_t(), k);
+		mpz_class r;
+		mpz_fdiv_r_2exp(r.get_mpz_t(), m.get_mpz_t(), k);
+		int cmp = mpz_cmp(r.get_mpz_t(), shifted(mpz_class(1), sint(k) - 1).get_mpz_t());
+		if (cmp > 0 || (cmp == 0 && mpz_odd_p(q.get_mpz_t()))) q += 1;
+		double d = std::ldexp(q.get_d(), int(mExponent + sint(k)));
+		return mMantissa < 0 ? -d : d;
+	}
+
+	Dyadic operator-() const {
+		return Dyadic(-mMantissa, mExponent);
+	}
+	friend Dyadic operator+(const Dyadic& lhs, const Dyadic& rhs) {
+		if (lhs.mMantissa == 0) return rhs;
+		if (rhs.mMantissa == 0) return lhs;
+		if (lhs.mExponent < rhs.mExponent) {
+			return Dyadic(lhs.mMantissa + shifted(rhs.mMantissa, rhs.mExponent - lhs.mExponent), lhs.mExponent);
+		}
+		return Dyadic(shifted(lhs.mMantissa, lhs.mExponent - rhs.mExponent) + rhs.mMantissa, rhs.mExponent);
+	}
+	friend Dyadic operator-(const Dyadic& lhs, const Dyadic& rhs) {
+		return lhs + (-rhs);
+	}
+	friend Dyadic operator*(const Dyadic& lhs, const Dyadic& rhs) {
+		return Dyadic(lhs.mMantissa * rhs.mMantissa, lhs.mExponent + rhs.mExponent);
+	}
+	/**
+	 * Division is only exact if the result is a dyadic number, for example if rhs is a power of two.
+	 * Otherwise, the result is rounded down to precision().
+	 */
+	friend Dyadic operator/(const Dyadic& lhs, const Dyadic& rhs) {
+		return divide(lhs, rhs, precision(), false);
+	}
+	Dyadic& operator+=(const Dyadic& rhs) {
+		return *this = *this + rhs;
+	}
+	Dyadic& operator-=(const Dyadic& rhs) {
+		return *this = *this - rhs;
+	}
+	Dyadic& operator*=(const Dyadic& rhs) {
+		return *this = *this * rhs;
+	}
+	Dyadic& operator/=(const Dyadic& rhs) {
+		return *this = *this / rhs;
+	}
+
+	/// Returns a negative value, zero or a positive value if lhs is smaller, equal or larger than rhs.
+	friend int compare(const Dyadic& lhs, const Dyadic& rhs) {
+		int sl = sgn(lhs.mMantissa);
+		int sr = sgn(rhs.mMantissa);
+		if (sl != sr || sl == 0) return sl - sr;
+		if (lhs.mExponent < rhs.mExponent) {
+			return cmp(lhs.mMantissa, shifted(rhs.mMantissa, rhs.mExponent - lhs.mExponent));
+		}
+		return cmp(shifted(lhs.mMantissa, lhs.mExponent - rhs.mExponent), rhs.mMantissa);
+	}
+	friend bool operator==(const Dyadic& lhs, const Dyadic& rhs) {
+		// Normalized representations are unique.
+		return lhs.mExponent == rhs.mExponent && lhs.mMantissa == rhs.mMantissa;
+	}
+	friend bool operator!=(const Dyadic& lhs, const Dyadic& rhs) {
+		return !(lhs == rhs);
+	}
+	friend bool operator<(const Dyadic& lhs, const Dyadic& rhs) {
+		return compare(lhs, rhs) < 0;
+	}
+	friend bool operator<=(const Dyadic& lhs, const Dyadic& rhs) {
+		return compare(lhs, rhs) <= 0;
+	}
+	friend bool operator>(const Dyadic& lhs, const Dyadic& rhs) {
+		return compare(lhs, rhs) > 0;
+	}
+	friend bool operator>=(const Dyadic& lhs, const Dyadic& rhs) {
+		return compare(lhs, rhs) >= 0;
+	}
+
+	friend std::ostream& operator<<(std::ostream& os, const Dyadic& d) {
+		return os << d.toRational();
+	}
+};
+
+template<>
+struct is_number<Dyadic>: std::true_type {};
+
+template<>
+struct IntegralType<Dyadic> {
+	using type = mpz_class;
+};
+
+inline bool isZero(const Dyadic& d) {
+	return d.mantissa() == 0;
+}
+inline bool isOne(const Dyadic& d) {
+	return d.mantissa() == 1 && d.exponent() == 0;
+}
+inline bool isPositive(const Dyadic& d) {
+	return d.mantissa() > 0;
+}
+inline bool isNegative(const Dyadic& d) {
+	return d.mantissa() < 0;
+}
+inline bool isInteger(const Dyadic& d) {
+	return d.exponent() >= 0;
+}
+inline double toDouble(const Dyadic& d) {
+	return d.toDouble();
+}
+inline Dyadic abs(const Dyadic& d) {
+	return isNegative(d) ? -d : d;
+}
+inline mpz_class floor(const Dyadic& d) {
+	if (d.exponent() >= 0) return mpz_class(d.toRational());
+	mpz_class res;
+	mpz_fdiv_q_2exp(res.get_mpz_t(), d.mantissa().get_mpz_t(), mp_bitcnt_t(-d.exponent()));
+	return res;
+}
+inline mpz_class ceil(const Dyadic& d) {
+	if (d.exponent() >= 0) return mpz_class(d.toRational());
+	mpz_class res;
+	mpz_cdiv_q_2exp(res.get_mpz_t(), d.mantissa().get_mpz_t(), mp_bitcnt_t(-d.exponent()));
+	return res;
+}
+inline Dyadic pow(const Dyadic& d, std::size_t exp) {
+	mpz_class m;
+	mpz_pow_ui(m.get_mpz_t(), d.mantissa().get_mpz_t(), exp);
+	return Dyadic(m, d.exponent() * sint(exp));
+}
+
+}
+
+namespace std {
+	template<>
+	struct hash<carl::Dyadic> {
+		std::size_t operator()(const carl::Dyadic& d) const {
+			std::size_t seed = 0;
+			carl::hash_add(seed, d.mantissa(), d.exponent());
+			return seed;
+		}
+	};
+}
@@ -66,5 +66,6 @@ namespace carl {
 #include "GaloisField.h"
 #include "GFNumber.h"
 #include "Numeric.h"
+#include "Dyadic.h"
 
 #include "conversion/conversion.h"
@@ -39,6 +39,8 @@ private:
 	std::list<Alpha> mAda;
 	std::list<uint> mAdaHelper;
 	Eigen::MatrixXf mMatrix;
+	// the decomposition of mMatrix, reused for every polynomial processed until the next update
+	Eigen::PartialPivLU<Eigen::MatrixXf> mDecomposition;
 	bool mNeedsUpdate = false;
 	
 	
@@ -61,6 +63,7 @@ public:
 		mAda(other.mAda),
 		mAdaHelper(other.mAdaHelper),
 		mMatrix(other.mMatrix),
+		mDecomposition(other.mDecomposition),
 		mNeedsUpdate(other.mNeedsUpdate)
 	{}
 	
@@ -77,6 +80,12 @@ public:
 	const auto& matrix() const { return mMatrix; }
 	bool needsUpdate() const { return mNeedsUpdate; }
 	
+	/*
+	 * sets the number of threads used to evaluate the tarski queries of a polynomial
+	 */
+	void setThreads(std::size_t threads) { mTaQ.setThreads(threads); }
+	std::size_t threads() const { return mTaQ.threads(); }
+	
 	
 private:
 	static int sigmaToTheAlpha(const Alpha& alpha, const SignCondition& sigma) {
@@ -111,15 +120,6 @@ private:
 		}
 		return res;
 	} 
-	static Eigen::MatrixXf kroneckerProduct(const Eigen::MatrixXf& m1, const Eigen::MatrixXf& m2) {
-		Eigen::MatrixXf m3(m1.rows() * m2.rows(), m1.cols() * m2.cols());
-		for(int i = 0; i < m1.cols(); i++) {
-			for(int j = 0; j < m1.rows(); j++) {
-				m3.block(i * m2.rows(), j * m2.cols(), m2.rows(), m2.cols()) =  m1(i, j) * m2;
-			}
-		}
-		return m3;
-	}
 	static void removeColumn(Eigen::MatrixXf& matrix, Eigen::Index colToRemove) {
 		Eigen::Index numRows = matrix.rows();
 		Eigen::Index numCols = matrix.cols()-1;
@@ -272,6 +272,7 @@ private:
 		mAda = newAda;
 		mMatrix = adaptedMat(mAda, mSigns);
 		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(mMatrix).rank() == mMatrix.cols(), "mMatrix must be invertible!");
+		mDecomposition.compute(mMatrix);
 		mProducts = adaptedProducts;
 		mNeedsUpdate = false;
 		CARL_LOG_DEBUG("carl.thom.sign", *this);
@@ -299,10 +300,12 @@ private:
 		//     and an corrspoding adapted list
 		std::list<SignCondition> currSigns;
 		std::list<Alpha> currAda;
-		TaQResType taq1 = mTaQ(p);
-		currProducts.push_back(p);
 		Polynomial psquare = p*p;
-		TaQResType taq2 = mTaQ(psquare);
+		std::vector<Polynomial> queries = {p, psquare};
+		std::vector<TaQResType> taqs = mTaQ(queries.begin(), queries.end());
+		TaQResType taq1 = taqs[0];
+		TaQResType taq2 = taqs[1];
+		currProducts.push_back(p);
 		currProducts.push_back(psquare);
 		CARL_LOG_ASSERT("carl.thom.sign",  std::abs(taq1) <= taq0 && std::abs(taq2) <= taq0, "tarski query failure");
 		int czer = taq0 - taq2;
@@ -328,17 +331,23 @@ private:
 		// (2)
 		products = this->computeProducts(p, currAda);
 		
-		Eigen::VectorXf dprime(long(products.size()));
-		long index = 0;
-		for (const auto& prod : products) {
-			dprime(index) = float(mTaQ(prod));
-			index++;
+		// the tarski queries of the products are independent
+		std::vector<TaQResType> taqs_prime = mTaQ(products.begin(), products.end());
+		Eigen::MatrixXf dprime(currM.rows(), mMatrix.rows());
+		CARL_LOG_ASSERT("carl.thom.sign", taqs_prime.size() == std::size_t(dprime.size()), "");
+		for (Eigen::Index i = 0; i < dprime.rows(); i++) {
+			for (Eigen::Index j = 0; j < dprime.cols(); j++) {
+				dprime(i, j) = float(taqs_prime[std::size_t(i * dprime.cols() + j)]);
+			}
 		}
 		
-		Eigen::MatrixXf M_prime = kroneckerProduct(currM, mMatrix);
-		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(M_prime).rank() == M_prime.cols(), "M_prime must be invertible!");
-		Eigen::PartialPivLU<Eigen::MatrixXf> dec(M_prime);
-		Eigen::VectorXf c = dec.solve(dprime);
+		// The matrix of the system is the kronecker product of currM and mMatrix.
+		// Writing the vectors row by row as matrices, the system reads currM * C * mMatrix^T = D,
+		// hence it is solved using the small matrix currM and the stored decomposition of mMatrix.
+		CARL_LOG_ASSERT("carl.thom.sign", Eigen::FullPivLU<Eigen::MatrixXf>(currM).rank() == currM.cols(), "currM must be invertible!");
+		Eigen::MatrixXf Y = Eigen::PartialPivLU<Eigen::MatrixXf>(currM).solve(dprime);
+		Eigen::MatrixXf Ct = mDecomposition.solve(Eigen::MatrixXf(Y.transpose()));
+		Eigen::VectorXf c = Eigen::Map<Eigen::VectorXf>(Ct.data(), Ct.size());
 		CARL_LOG_ASSERT("carl.thom.sign", (uint)c.size() == currSigns.size() * mSigns.size(), "failure in sign determination");
 		
 		std::list<SignCondition> newSigns;
@@ -391,6 +400,7 @@ public:
 		if(mP.empty()) {
 			mAda = newAda;
 			mMatrix = newMatrix;
+			mDecomposition.compute(mMatrix);
 			mNeedsUpdate = false;
 		}
 		mP.push_front(p);
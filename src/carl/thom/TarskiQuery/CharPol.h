@@ -46,6 +46,12 @@ void printMatrix(const CoeffMatrix<Coeff>& m) {
 	}
 }
 
+// computes the trace of a * b without computing the product, i.e. the sum of a(i, j) * b(j, i)
+template<typename Coeff>
+Coeff traceOfProduct(const CoeffMatrix<Coeff>& a, const CoeffMatrix<Coeff>& b) {
+	return a.cwiseProduct(b.transpose()).sum();
+}
+
 // algorithm 8.17, p. 300
 template<typename Coeff>
 std::vector<Coeff> charPol(const CoeffMatrix<Coeff>& m) {
@@ -81,8 +87,7 @@ std::vector<Coeff> charPol(const CoeffMatrix<Coeff>& m) {
 	
 	for(std::size_t i = 1; i < r; i++) {
 		for(std::size_t j = 1; j < r; j++) {
-			CoeffMatrix<Coeff> tmp(B[i] * C[j-1]);
-			N[j*r + i] = tmp.trace();
+			N[j*r + i] = traceOfProduct(B[i], C[j-1]);
 		}
 	}
 	N.resize(std::size_t(n) + 1);
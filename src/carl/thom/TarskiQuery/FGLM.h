@@ -0,0 +1,151 @@
+/*
+ * File:   FGLM.h
+ *
+ * Conversion of groebner bases of zero-dimensional ideals to the lexicographic ordering.
+ */
+
+#pragma once
+
+#include "../../core/MultivariatePolynomial.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+template<typename Number>
+struct BaseRepresentation;
+template<typename Number>
+class MultiplicationTable;
+
+/*
+ * The FGLM algorithm by Faugere, Gianni, Lazard and Mora.
+ * Computes the reduced groebner base of a zero-dimensional ideal with respect to the lexicographic ordering
+ * with variables[0] > variables[1] > ..., given the multiplication table of the factor ring modulo the ideal.
+ *
+ * Monomials are visited in increasing lexicographic order. The normal form of a monomial x_i * u is obtained from the normal form of u
+ * and the normal forms of x_i * b for all b in the base, which are taken from the table.
+ * If the normal form is linearly dependent on the normal forms of the monomials visited before, the dependency is a new element of the groebner base.
+ * Otherwise, the monomial is in the new staircase. The linear dependencies are detected by sparse gaussian elimination over the rationals.
+ *
+ * The result is sorted by the lexicographic leading monomials, hence it starts with the univariate polynomial in the smallest variable.
+ * All variables of the ideal must be given.
+ */
+template<typename Number>
+std::vector<MultivariatePolynomial<Number>> fglm(const MultiplicationTable<Number>& table, const std::vector<Variable>& variables) {
+	using Monomial = Term<Number>;
+	using Exponents = std::vector<uint>;
+	using Combination = std::map<std::size_t, Number>;
+	// the normal form of a linear combination of staircase monomials, with a pivot coefficient of one
+	struct Row {
+		BaseRepresentation<Number> nf;
+		Combination combination;
+	};
+	auto addMultiple = [](auto& target, const auto& source, const Number& factor) {
+		for(const auto& entry : source) {
+			Number& c = target[entry.first];
+			c += factor * entry.second;
+			if(carl::isZero(c)) target.erase(entry.first);
+		}
+	};
+	auto toMonomial = [&variables](const Exponents& exponents) {
+		Monomial res(Number(1));
+		for(std::size_t i = 0; i < exponents.size(); i++) {
+			for(uint d = 0; d < exponents[i]; d++) res = res * variables[i];
+		}
+		return res;
+	};
+	auto divisible = [](const Exponents& m, const Exponents& d) {
+		for(std::size_t i = 0; i < m.size(); i++) {
+			if(m[i] < d[i]) return false;
+		}
+		return true;
+	};
+
+	const std::vector<Monomial>& base = table.getBase();
+	std::map<uint, Row> rows;
+	std::vector<Monomial> staircase;
+	std::vector<BaseRepresentation<Number>> normalForms;
+	std::vector<Exponents> leading;
+	std::vector<MultivariatePolynomial<Number>> result;
+
+	// std::vector compares lexicographically, hence the candidates are sorted by the lexicographic ordering.
+	// Every candidate stores the staircase monomial and the variable it is the product of, if it is not the constant.
+	std::map<Exponents, std::pair<std::size_t, std::size_t>> candidates;
+	candidates.emplace(Exponents(variables.size(), 0), std::make_pair(std::size_t(0), variables.size()));
+	while(!candidates.empty()) {
+		Exponents exponents = candidates.begin()->first;
+		std::pair<std::size_t, std::size_t> origin = candidates.begin()->second;
+		candidates.erase(candidates.begin());
+		bool redundant = false;
+		for(const auto& l : leading) {
+			if(divisible(exponents, l)) {
+				redundant = true;
+				break;
+			}
+		}
+		if(redundant) continue;
+
+		BaseRepresentation<Number> nf;
+		if(origin.second == variables.size()) {
+			nf = table.reduce(MultivariatePolynomial<Number>(Number(1)));
+		}
+		else {
+			for(const auto& entry : normalForms[origin.first]) {
+				Monomial product = base[entry.first] * variables[origin.second];
+				CARL_LOG_ASSERT("carl.thom.fglm", table.contains(product), "the variables do not match the table");
+				addMultiple(nf, table.getEntry(product).br, entry.second);
+			}
+		}
+		CARL_LOG_TRACE("carl.thom.fglm", "normal form of " << toMonomial(exponents) << ": " << nf);
+
+		// reduce nf by the rows, afterwards nf = nf(m) - sum combination[k] * nf(staircase[k])
+		BaseRepresentation<Number> reduced = nf;
+		Combination combination;
+		auto pos = reduced.begin();
+		while(pos != reduced.end()) {
+			auto row = rows.find(pos->first);
+			if(row == rows.end()) {
+				++pos;
+				continue;
+			}
+			uint pivot = pos->first;
+			Number factor = pos->second;
+			addMultiple(reduced, row->second.nf, -factor);
+			addMultiple(combination, row->second.combination, factor);
+			pos = reduced.upper_bound(pivot);
+		}
+
+		if(reduced.isZero()) {
+			MultivariatePolynomial<Number> p(toMonomial(exponents));
+			for(const auto& entry : combination) {
+				p -= entry.second * staircase[entry.first];
+			}
+			CARL_LOG_DEBUG("carl.thom.fglm", "new element of the lexicographic base: " << p);
+			result.push_back(p);
+			leading.push_back(exponents);
+			continue;
+		}
+
+		std::size_t index = staircase.size();
+		uint pivot = reduced.begin()->first;
+		Number inverse = Number(1) / reduced.begin()->second;
+		Row row;
+		addMultiple(row.nf, reduced, inverse);
+		row.combination[index] = inverse;
+		addMultiple(row.combination, combination, -inverse);
+		rows.emplace(pivot, std::move(row));
+		staircase.push_back(toMonomial(exponents));
+		normalForms.push_back(std::move(nf));
+		CARL_LOG_ASSERT("carl.thom.fglm", staircase.size() <= base.size(), "the staircase is larger than the base");
+		for(std::size_t i = 0; i < variables.size(); i++) {
+			Exponents next = exponents;
+			next[i]++;
+			candidates.emplace(next, std::make_pair(index, i));
+		}
+	}
+	return result;
+}
+
+}
@@ -65,6 +65,12 @@ public:
         
         
         std::set<Variable> gatherVariables() const;
+        
+        /*
+         * Computes the groebner base of the same ideal with respect to the lexicographic ordering with variables[0] > variables[1] > ...
+         * by converting this base with fglm. Requires a zero-dimensional ideal.
+         */
+        std::vector<MultivariatePolynomial<Number>> lexBase(const std::vector<Variable>& variables) const;
 };
 
 }
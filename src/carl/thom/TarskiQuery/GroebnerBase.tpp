@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include "FGLM.h"
+#include "MultiplicationTable.h"
+
 namespace carl {
         
              
@@ -147,5 +150,13 @@ std::set<Variable> GroebnerBase<Number>::gatherVariables() const {
         return vars;
 }
 
+
+template<typename Number>
+std::vector<MultivariatePolynomial<Number>> GroebnerBase<Number>::lexBase(const std::vector<Variable>& variables) const {
+        if(this->isTrivialBase()) return this->get();
+        CARL_LOG_ASSERT("carl.thom.groebner", this->hasFiniteMon(), "tried to compute lex base of non-zerodimensional system");
+        MultiplicationTable<Number> table(*this);
+        return fglm(table, variables);
+}
         
 } // namespace carl
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "GroebnerBase.h"
+#include "SparseMatrix.h"
 
 namespace carl {
 	
@@ -40,6 +41,13 @@ struct BaseRepresentation : public std::map<uint, Number> {
 		if(it == this->end()) return Number(0);
 		else return it->second;
 	}
+	std::vector<Number> toDense(std::size_t size) const {
+		std::vector<Number> res(size, Number(0));
+		for(const auto& entry : *this) {
+			res[entry.first] = entry.second;
+		}
+		return res;
+	}
 };
 
 /*
@@ -50,6 +58,10 @@ struct BaseRepresentation : public std::map<uint, Number> {
  * 
  * where the base representation is the monomial viewed as a linear combination of the basis
  * and index pairs stores a list of all pairs of basis elements whose product is equal to Monomial
+ *
+ * Additionally, the multiplication by a variable x_i is stored as a sparse matrix M_x_i, where column j is the base representation of x_i * base_j.
+ * The trace form Tr(base_k * base_l) is stored as a sparse matrix as well, hence the trace of any product
+ * is a scalar product of dense vectors.
  */
 template<typename Number>
 class MultiplicationTable {
@@ -74,9 +86,18 @@ private:
 	// the groebner base object is used to compute reductions
 	GroebnerBase<Number> mGb;
 	
+	// the matrices expressing multiplication by a variable
+	std::map<Variable, SparseMatrix<Number>> mMatrices;
+	
+	// mTraceVector[k] is the trace of multiplication by base_k
+	std::vector<Number> mTraceVector;
+	
+	// the entry (k, l) is the trace of multiplication by base_k * base_l
+	SparseMatrix<Number> mTraceMatrix;
+	
 public:
 	
-	MultiplicationTable() : mTable(), mBase(), mGb() {}
+	MultiplicationTable() : mTable(), mBase(), mGb(), mMatrices(), mTraceVector(), mTraceMatrix() {}
 	
 	explicit MultiplicationTable(const GroebnerBase<Number>& gb) : mGb(gb){
 		CARL_LOG_ASSERT("carl.thom.tarski.table", gb.hasFiniteMon(), "tried to set up a multiplication table on infinite basis");
@@ -98,6 +119,17 @@ public:
 		return mBase;
 	}
 	
+	// the matrix expressing multiplication by var, or nullptr if var does not occur in the groebner base
+	const SparseMatrix<Number>* multiplicationMatrix(Variable var) const {
+		auto it = mMatrices.find(var);
+		if(it == mMatrices.end()) return nullptr;
+		return &it->second;
+	}
+	
+	const SparseMatrix<Number>& traceMatrix() const noexcept {
+		return mTraceMatrix;
+	}
+	
 	BaseRepresentation<Number> reduce(const MultivariatePolynomial<Number>& p) const {
 		return BaseRepresentation<Number>(mBase, mGb.reduce(p));
 	}
@@ -135,13 +167,14 @@ public:
 	
 	
 	Number trace(const BaseRepresentation<Number>& f) const {
+		return dot(mTraceVector, f);
+	}
+	
+	Number trace(const std::vector<Number>& f) const {
+		CARL_LOG_ASSERT("carl.thom.tarski", f.size() == mBase.size(), "dimension mismatch");
 		Number res(0);
-		for(const auto& index_coeff : f) {
-			for(uint i = 0; i < mBase.size(); i++) {
-				Monomial prod = mBase[index_coeff.first] * mBase[i];
-				BaseRepresentation<Number> prod_br = this->getEntry(prod).br;
-				res += index_coeff.second * prod_br.get(i);
-			}		   
+		for(std::size_t i = 0; i < f.size(); i++) {
+			res += mTraceVector[i] * f[i];
 		}
 		return res;
 	}
@@ -259,7 +292,16 @@ private:
 		}
 		
 		// ---- step 2 ----
-		// construct the matrices expressing multiplication by a variable (see step 2)
+		// construct the matrices expressing multiplication by a variable
+		// every product of a variable and an element of Mon is either in Mon or in Bor
+		for(const auto& var : vars) {
+			std::vector<BaseRepresentation<Number>> columns;
+			for(const auto& m : Mon) {
+				CARL_LOG_ASSERT("carl.thom.tarski.table", this->contains(var * m), "");
+				columns.push_back(this->getEntry(var * m).br);
+			}
+			mMatrices[var] = SparseMatrix<Number>::fromColumns(Mon.size(), columns);
+		}
 		
 		// ---- step 3 ----
 		// find the normal forms of all other elements in Tab(Mon)
@@ -290,6 +332,23 @@ private:
 				mTable[m] = {baseRepr, pairs};
 			}
 		}
+		
+		// ---- step 4 ----
+		// the trace of multiplication by base_k is the sum of the diagonal entries, i.e. of the coefficients of base_i in base_k * base_i
+		mTraceVector.assign(Mon.size(), Number(0));
+		for(uint k = 0; k < Mon.size(); k++) {
+			for(uint i = 0; i < Mon.size(); i++) {
+				mTraceVector[k] += this->getEntry(Mon[k] * Mon[i]).br.get(i);
+			}
+		}
+		std::vector<BaseRepresentation<Number>> traceColumns(Mon.size());
+		for(uint l = 0; l < Mon.size(); l++) {
+			for(uint k = 0; k < Mon.size(); k++) {
+				Number t = trace(this->getEntry(Mon[k] * Mon[l]).br);
+				if(!carl::isZero(t)) traceColumns[l][k] = t;
+			}
+		}
+		mTraceMatrix = SparseMatrix<Number>::fromColumns(Mon.size(), traceColumns);
 	}
 };
 
@@ -14,45 +14,26 @@
 namespace carl {
         
         
+/*
+ * Computes the Tarski query of the polynomial whose normal form is given as a dense vector q.
+ * The matrix of the quadratic form Tr(q * base_i * base_j) is set up using the trace form of the table:
+ * w = T * q is the linear form f -> Tr(q * f), hence every entry is a single scalar product with the normal form of base_i * base_j.
+ */
 template<typename Number>
-int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
-        CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
-        BaseRepresentation<Number> q = table.reduce(Q);
-        std::vector<typename MultiplicationTable<Number>::Monomial> base = table.getBase();
-        // compute the traces...
+int multivariateTarskiQuery(const std::vector<Number>& q, const MultiplicationTable<Number>& table) {
+        const auto& base = table.getBase();
+        CARL_LOG_ASSERT("carl.thom.tarski", q.size() == base.size(), "dimension mismatch");
         CoeffMatrix<Number> m(base.size(), base.size());
         CARL_LOG_INFO("carl.thom.tarski", "base size is " << base.size());
         CARL_LOG_INFO("carl.thom.tarski", "setting up the matrix now ...");
+        std::vector<Number> w = table.traceMatrix().multiply(q);
         for(const auto& entry : table) {
-                BaseRepresentation<Number> Qc = table.multiply(q, entry.second.br);
-                Number t = table.trace(Qc);
+                Number t = dot(w, entry.second.br);
                 for (const auto& pair : entry.second.pairs) {
                         m(long(pair.first), long(pair.second)) = t;
                 }
         }
         
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {    
-                        BaseRepresentation<Number> prod = table.getEntry(base[i] * base[j]).br;
-                        BaseRepresentation<Number> Qc = table.multiply(q, prod);
-                        //BaseRepresentation<Number> Qc = table.reduce(base[i] * base[j] * Q);
-                        Number t = table.trace(Qc);
-                        m(i, j) = t;
-                        m(j, i) = t;
-                }
-        }
-        */
-        /*
-        for(uint i = 0; i < base.size(); i++) {
-                for(uint j = i; j < base.size(); j++) {
-                        std::cout << m(i, j) << "\t\t";
-                }
-                std::cout << std::endl;
-        }
-        std::cout << std::endl;
-        */
-        
         CARL_LOG_INFO("carl.thom.tarski", "... done setting up matrix.");
         std::vector<Number> cp = charPol(m);
         CARL_LOG_TRACE("carl.thom.tarski", "char pol: " << cp);
@@ -67,4 +48,10 @@ int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const Multi
         return v1 - v2;
 }
 
+template<typename Number>
+int multivariateTarskiQuery(const MultivariatePolynomial<Number>& Q, const MultiplicationTable<Number>& table) {
+        CARL_LOG_FUNC("carl.thom.tarski", "Q = " << Q);
+        return multivariateTarskiQuery(table.reduce(Q).toDense(table.getBase().size()), table);
+}
+
 } // namespace carl
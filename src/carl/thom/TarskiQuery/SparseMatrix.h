@@ -0,0 +1,104 @@
+/*
+ * File:   SparseMatrix.h
+ *
+ * Matrices in compressed sparse row format, used to represent linear maps on the factor ring.
+ */
+
+#pragma once
+
+#include "../../core/logging.h"
+
+#include <cassert>
+#include <utility>
+#include <vector>
+
+namespace carl {
+
+/*
+ * A matrix in compressed sparse row (CSR) format.
+ * The nonzero entries of row i are stored at the positions rowOffsets[i], ..., rowOffsets[i+1] - 1 of columns and values,
+ * ordered by their column. Vectors are dense and stored contiguously, hence the kernels below only walk plain arrays.
+ */
+template<typename Number>
+class SparseMatrix {
+
+	std::size_t mRows = 0;
+	std::size_t mCols = 0;
+	std::vector<std::size_t> mRowOffsets = std::vector<std::size_t>(1, 0);
+	std::vector<std::size_t> mColumns;
+	std::vector<Number> mValues;
+
+public:
+
+	SparseMatrix() = default;
+
+	/*
+	 * Builds the matrix from its columns. Every column is a range of (row, value) pairs sorted by row, e.g. a BaseRepresentation.
+	 */
+	template<typename Column>
+	static SparseMatrix fromColumns(std::size_t rows, const std::vector<Column>& columns) {
+		SparseMatrix res;
+		res.mRows = rows;
+		res.mCols = columns.size();
+		res.mRowOffsets.assign(rows + 1, 0);
+		for(const auto& column : columns) {
+			for(const auto& entry : column) {
+				assert(std::size_t(entry.first) < rows);
+				res.mRowOffsets[std::size_t(entry.first) + 1]++;
+			}
+		}
+		for(std::size_t i = 0; i < rows; i++) {
+			res.mRowOffsets[i + 1] += res.mRowOffsets[i];
+		}
+		res.mColumns.resize(res.mRowOffsets.back());
+		res.mValues.resize(res.mRowOffsets.back());
+		// the columns are visited in increasing order, hence the entries of every row end up sorted
+		std::vector<std::size_t> next(res.mRowOffsets.begin(), res.mRowOffsets.end() - 1);
+		for(std::size_t j = 0; j < columns.size(); j++) {
+			for(const auto& entry : columns[j]) {
+				std::size_t pos = next[std::size_t(entry.first)]++;
+				res.mColumns[pos] = j;
+				res.mValues[pos] = entry.second;
+			}
+		}
+		return res;
+	}
+
+	std::size_t rows() const noexcept { return mRows; }
+	std::size_t cols() const noexcept { return mCols; }
+	std::size_t nonZeros() const noexcept { return mValues.size(); }
+
+	Number get(std::size_t row, std::size_t col) const {
+		for(std::size_t k = mRowOffsets[row]; k < mRowOffsets[row + 1]; k++) {
+			if(mColumns[k] == col) return mValues[k];
+		}
+		return Number(0);
+	}
+
+	// computes m * v
+	std::vector<Number> multiply(const std::vector<Number>& v) const {
+		CARL_LOG_ASSERT("carl.thom.tarski", v.size() == mCols, "dimension mismatch");
+		std::vector<Number> res(mRows, Number(0));
+		for(std::size_t i = 0; i < mRows; i++) {
+			Number& r = res[i];
+			for(std::size_t k = mRowOffsets[i]; k < mRowOffsets[i + 1]; k++) {
+				r += mValues[k] * v[mColumns[k]];
+			}
+		}
+		return res;
+	}
+};
+
+/*
+ * The scalar product of a dense vector and a sparse one, given as (index, value) pairs.
+ */
+template<typename Number, typename Sparse>
+Number dot(const std::vector<Number>& dense, const Sparse& sparse) {
+	Number res(0);
+	for(const auto& entry : sparse) {
+		res += dense[std::size_t(entry.first)] * entry.second;
+	}
+	return res;
+}
+
+} // namespace carl
@@ -7,7 +7,15 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <iterator>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#ifdef THREAD_SAFE
+#include <thread>
+#endif
 
 #include "MultiplicationTable.h"
 #include "MultivariateTarskiQuery.h"
@@ -19,6 +27,8 @@ namespace carl {
 /*
  * The Tarski query manager is a class designed to manage the computation of Tarski queries.
  * 
+ * Query results and normal forms are cached. The cache is shared by all copies of a manager and may be accessed concurrently,
+ * hence batches of queries can be evaluated by multiple threads.
  */ 
 template<typename Number>
 class TarskiQueryManager {
@@ -37,7 +47,24 @@ private:
         MultiplicationTable<Number> mTab;
         bool mTrivialGb = false;
         
-        mutable std::map<Polynomial, QueryResultType> mCache;
+        struct Cache {
+                // results of normalized polynomials, keyed by their hash values
+                std::unordered_multimap<std::size_t, std::pair<Polynomial, QueryResultType>> results;
+                // dense normal forms of the monomials occurring in queries, shared by all queries
+                std::unordered_map<Monomial::Arg, std::vector<Number>> normalForms;
+                std::mutex resultsMutex;
+                // also guards all reductions modulo the groebner base, as the divisor lookup of an ideal is not thread-safe
+                std::mutex normalFormsMutex;
+        };
+        std::shared_ptr<Cache> mCache = std::make_shared<Cache>();
+        
+        std::size_t mThreads = defaultThreads();
+        
+        // read by every constructor, possibly from several threads
+        static std::atomic<std::size_t>& defaultThreadsStorage() {
+                static std::atomic<std::size_t> threads(1);
+                return threads;
+        }
         
 public:
         TarskiQueryManager() = default;
@@ -72,6 +99,27 @@ public:
                 }
         }
         
+        /*
+         * the number of threads used by managers constructed afterwards, e.g. by the thom root finder
+         */
+        static std::size_t defaultThreads() {
+                return defaultThreadsStorage().load();
+        }
+        static void setDefaultThreads(std::size_t threads) {
+                defaultThreadsStorage().store(std::max(threads, std::size_t(1)));
+        }
+        
+        /*
+         * sets the number of threads used to evaluate batches of queries.
+         * without THREAD_SAFE, batches are always evaluated sequentially.
+         */
+        void setThreads(std::size_t threads) {
+                mThreads = std::max(threads, std::size_t(1));
+        }
+        std::size_t threads() const {
+                return mThreads;
+        }
+        
         QueryResultType operator()(const Polynomial& p) const {
                 CARL_LOG_TRACE("carl.thom.tarski.manager", "computing taq on " << p << " ... ");
                 if(p.isZero()) return 0;
@@ -99,7 +147,7 @@ public:
                         if(mTrivialGb) res = 0;
                         else {
                         // todo: check if variables in p are also in the polynomials defining the zero set
-                                res = multivariateTarskiQuery(p, mTab);
+                                res = multivariateTarskiQuery(normalForm(p), mTab);
                         }
                 }
                 cache(p, res);
@@ -111,12 +159,41 @@ public:
                 return (*this)(Polynomial(c));
         }
         
+        /*
+         * evaluates a batch of independent queries, using up to threads() threads
+         */
+        template<typename InputIt>
+        std::vector<QueryResultType> operator()(InputIt first, InputIt last) const {
+                std::vector<Polynomial> queries(first, last);
+                std::vector<QueryResultType> res(queries.size());
+                std::atomic<std::size_t> next(0);
+                auto worker = [&]() {
+                        for(std::size_t i = next++; i < queries.size(); i = next++) {
+                                res[i] = (*this)(queries[i]);
+                        }
+                };
+#ifdef THREAD_SAFE
+                std::size_t threads = std::min(mThreads, queries.size());
+                if(threads > 1) {
+                        std::vector<std::thread> pool;
+                        for(std::size_t t = 0; t < threads; t++) {
+                                pool.emplace_back(worker);
+                        }
+                        for(auto& t : pool) t.join();
+                        return res;
+                }
+#endif
+                worker();
+                return res;
+        }
+        
         Polynomial reduceProduct(const Polynomial& a, const Polynomial& b) const {
                 if(this->isUnivariateManager()) {
                         // todo: implement
                         return a * b;
                 }
                 else {
+                        std::lock_guard<std::mutex> lock(mCache->normalFormsMutex);
                         return mTab.baseReprToPolynomial(mTab.reduce(a * b));
                 }
                 
@@ -130,14 +207,58 @@ private:
                 return !mZ.isZero();
         }
         
+        /*
+         * computes the normal form of p as a dense vector from the normal forms of its monomials
+         */
+        std::vector<Number> normalForm(const Polynomial& p) const {
+                std::lock_guard<std::mutex> lock(mCache->normalFormsMutex);
+                std::vector<Number> res(mTab.getBase().size(), Number(0));
+                for(const auto& term : p) {
+                        const std::vector<Number>& nf = normalForm(term.monomial());
+                        for(std::size_t i = 0; i < res.size(); i++) {
+                                res[i] += term.coeff() * nf[i];
+                        }
+                }
+                return res;
+        }
+        
+        /*
+         * computes the normal form of m as a dense vector.
+         * if m = x * m', the normal form is obtained by multiplying the normal form of m' with the matrix of x,
+         * hence all normal forms of the monomials dividing m are cached as well.
+         * the caller has to hold the lock on the normal forms.
+         */
+        const std::vector<Number>& normalForm(const Monomial::Arg& m) const {
+                auto it = mCache->normalForms.find(m);
+                if(it != mCache->normalForms.end()) return it->second;
+                std::vector<Number> nf;
+                const SparseMatrix<Number>* matrix = m ? mTab.multiplicationMatrix(m->exponents().front().first) : nullptr;
+                if(matrix != nullptr) {
+                        Monomial::Arg rest;
+                        m->divide(m->exponents().front().first, rest);
+                        nf = matrix->multiply(normalForm(rest));
+                }
+                else {
+                        // the constant monomial or a variable which does not occur in the groebner base
+                        Polynomial pm = m ? Polynomial(m) : Polynomial(Number(1));
+                        nf = mTab.reduce(pm).toDense(mTab.getBase().size());
+                }
+                return mCache->normalForms.emplace(m, std::move(nf)).first->second;
+        }
+        
         /*
          * looks for the normalization of p in the cache
          */
         bool getCached(const Polynomial& p, QueryResultType& res) const {
-                auto it = mCache.find(p.normalize());
-                if(it != mCache.end()) {
-						res = int(sgn(p.lcoeff())) * (it->second);
-                        return true;
+                Polynomial normalized = p.normalize();
+                std::size_t hash = std::hash<Polynomial>()(normalized);
+                std::lock_guard<std::mutex> lock(mCache->resultsMutex);
+                auto range = mCache->results.equal_range(hash);
+                for(auto it = range.first; it != range.second; ++it) {
+                        if(it->second.first == normalized) {
+                                res = int(sgn(p.lcoeff())) * (it->second.second);
+                                return true;
+                        }
                 }
                 return false;
         }
@@ -146,7 +267,14 @@ private:
          * writes normalized p with correspoding result in cache
          */
         void cache(const Polynomial& p, const QueryResultType res) const {
-                mCache.insert(std::make_pair(p.normalize(), int(sgn(p.lcoeff())) * res));
+                Polynomial normalized = p.normalize();
+                std::size_t hash = std::hash<Polynomial>()(normalized);
+                std::lock_guard<std::mutex> lock(mCache->resultsMutex);
+                auto range = mCache->results.equal_range(hash);
+                for(auto it = range.first; it != range.second; ++it) {
+                        if(it->second.first == normalized) return;
+                }
+                mCache->results.emplace(hash, std::make_pair(std::move(normalized), int(sgn(p.lcoeff())) * res));
         }
         
 }; // class TarskiQueryManager
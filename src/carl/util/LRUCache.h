@@ -0,0 +1,121 @@
+/**
+ * @file LRUCache.h
+ *
+ * A bounded map that drops its least recently used entries.
+ */
+
+#pragma once
+
+#include "../config.h"
+
+#include <limits>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace carl {
+
+/**
+ * A bounded map from keys to values that are expensive to compute, e.g. data derived from polynomials.
+ * If the cache is full, the least recently used entry is dropped.
+ * Values should be cheap to copy, for example shared pointers, as get() returns a copy.
+ *
+ * All members, including the statistics, are protected by a lock if THREAD_SAFE is defined.
+ * Values are created without holding the lock, such that other threads can use the cache meanwhile.
+ */
+template<typename Key, typename Value>
+class LRUCache {
+public:
+	/// The maximum size of a cache that never drops entries.
+	static constexpr std::size_t unbounded = std::numeric_limits<std::size_t>::max();
+private:
+	using LRUList = std::list<Key>;
+	struct Entry {
+		Value value;
+		typename LRUList::iterator position;
+	};
+	std::size_t mMaxSize;
+	LRUList mLRU;
+	std::unordered_map<Key, Entry> mEntries;
+	std::size_t mHits = 0;
+	std::size_t mMisses = 0;
+	mutable std::mutex mMutex;
+
+	#ifdef THREAD_SAFE
+	#define LRU_CACHE_LOCK_GUARD std::lock_guard<std::mutex> lock( mMutex );
+	#else
+	#define LRU_CACHE_LOCK_GUARD
+	#endif
+
+	/// Drops the least recently used entries until at most size entries are left.
+	void shrink(std::size_t size) {
+		while (mEntries.size() > size) {
+			mEntries.erase(mLRU.back());
+			mLRU.pop_back();
+		}
+	}
+public:
+	explicit LRUCache(std::size_t maxSize):
+		mMaxSize(maxSize)
+	{}
+
+	/**
+	 * Returns the value stored for the given key.
+	 * If there is none, create(key) is called and its result is stored.
+	 * If another thread stored a value for the key in the meantime, this value is returned instead.
+	 */
+	template<typename Create>
+	Value get(const Key& key, Create&& create) {
+		{
+			LRU_CACHE_LOCK_GUARD
+			auto it = mEntries.find(key);
+			if (it != mEntries.end()) {
+				mHits++;
+				mLRU.splice(mLRU.begin(), mLRU, it->second.position);
+				return it->second.value;
+			}
+			mMisses++;
+		}
+		Value value = create(key);
+		LRU_CACHE_LOCK_GUARD
+		if (mMaxSize == 0) return value;
+		auto it = mEntries.find(key);
+		if (it != mEntries.end()) return it->second.value;
+		shrink(mMaxSize - 1);
+		mLRU.push_front(key);
+		mEntries.emplace(key, Entry{ std::move(value), mLRU.begin() });
+		return mEntries.find(key)->second.value;
+	}
+
+	void setMaxSize(std::size_t maxSize) {
+		LRU_CACHE_LOCK_GUARD
+		mMaxSize = maxSize;
+		shrink(mMaxSize);
+	}
+	std::size_t size() const {
+		LRU_CACHE_LOCK_GUARD
+		return mEntries.size();
+	}
+	std::size_t hits() const {
+		LRU_CACHE_LOCK_GUARD
+		return mHits;
+	}
+	std::size_t misses() const {
+		LRU_CACHE_LOCK_GUARD
+		return mMisses;
+	}
+	/// Drops all entries and resets the statistics.
+	void clear() {
+		LRU_CACHE_LOCK_GUARD
+		mEntries.clear();
+		mLRU.clear();
+		mHits = 0;
+		mMisses = 0;
+	}
+};
+
+template<typename Key, typename Value>
+constexpr std::size_t LRUCache<Key, Value>::unbounded;
+
+}
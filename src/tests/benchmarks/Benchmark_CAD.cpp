@@ -0,0 +1,53 @@
+#include "gtest/gtest.h"
+
+#include "carl/cad/Projection.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/util/Timer.h"
+#include "BenchmarkTest.h"
+
+using namespace carl;
+
+namespace {
+	using Poly = MultivariatePolynomial<mpq_class>;
+
+	/**
+	 * Generalizes the example from "Improved Projection for Cylindrical Algebraic Decomposition", Figure 1,
+	 * to n variables: x_1^2 + ... + x_n^2 - 4 and x_1 * ... * x_n - 1.
+	 */
+	std::vector<Poly> qepcadExample(const std::vector<Variable>& vars) {
+		Poly sphere(-4);
+		Poly product(1);
+		for (auto v: vars) {
+			sphere += Poly(v) * v;
+			product *= v;
+		}
+		return { sphere, product - Poly(1) };
+	}
+
+	std::size_t projectionTime(const std::vector<Variable>& vars, cad::ProjectionType type, std::size_t threads, bool incremental) {
+		carl::Timer timer;
+		cad::Projection<Poly> proj(vars, type);
+		proj.setThreads(threads);
+		for (const auto& p: qepcadExample(vars)) {
+			proj.addPolynomial(p);
+			if (incremental) proj.project();
+		}
+		proj.project();
+		std::cout << type << " (" << threads << " threads" << (incremental ? ", incremental" : "") << "): " << proj.size() << " polynomials, " << timer.passed() << " ms" << std::endl;
+		return timer.passed();
+	}
+}
+
+TEST_F(BenchmarkTest, CADProjection)
+{
+	for (std::size_t n = 2; n <= 5; n++) {
+		std::vector<Variable> vars;
+		for (std::size_t i = 0; i < n; i++) vars.push_back(freshRealVariable());
+		BenchmarkResult res;
+		res["McCallum"] = projectionTime(vars, cad::ProjectionType::McCallum, 1, false);
+		res["Lazard"] = projectionTime(vars, cad::ProjectionType::Lazard, 1, false);
+		res["Incremental"] = projectionTime(vars, cad::ProjectionType::McCallum, 1, true);
+		res["Parallel"] = projectionTime(vars, cad::ProjectionType::McCallum, std::thread::hardware_concurrency(), false);
+		file.push(res, n);
+	}
+}
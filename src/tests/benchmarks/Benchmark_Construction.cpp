@@ -258,6 +258,13 @@ namespace carl {
 		}
         #endif
 	};
+	template<SubresultantStrategy Strategy>
+	struct ResultantStrategyExecutor {
+		template<typename Coeff>
+		CUMP<Coeff> operator()(const std::tuple<CUMP<Coeff>,CUMP<Coeff>>& args) {
+			return std::forward<const CUMP<Coeff>>(carl::resultant(std::get<0>(args), std::get<1>(args), Strategy));
+		}
+	};
 	struct GCDExecutor {
 		template<typename Coeff>
 		CMP<Coeff> operator()(const std::tuple<CMP<Coeff>,CMP<Coeff>>& args) {
@@ -453,6 +460,24 @@ TEST_F(BenchmarkTest, Resultant)
 	}
 }
 
+/*
+ * Resultants as they occur in the CAD projection: pairs of polynomials in three variables,
+ * the coefficients being multivariate polynomials in the remaining two.
+ */
+TEST_F(BenchmarkTest, ResultantStrategies)
+{
+	BenchmarkInformation bi(BenchmarkSelection::Random, 3);
+	bi.n = 10;
+	for (bi.degree = 3; bi.degree < 8; bi.degree++) {
+		BenchmarkResult res;
+		Benchmark<ResultantGenerator<Coeff>, ResultantStrategyExecutor<SubresultantStrategy::Lazard>, CUMP<Coeff>> lazard(bi, "Lazard");
+		Benchmark<ResultantGenerator<Coeff>, ResultantStrategyExecutor<SubresultantStrategy::Modular>, CUMP<Coeff>> modular(bi, "Modular");
+		for (const auto& r: lazard.result()) res.insert(r);
+		for (const auto& r: modular.result()) res.insert(r);
+		file.push(res, bi.degree);
+	}
+}
+
 TEST_F(BenchmarkTest, GCD)
 {
 	BenchmarkInformation bi(BenchmarkSelection::Random, 4);
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/util/Timer.h"
+#include "BenchmarkTest.h"
+
+using namespace carl;
+
+namespace {
+	using Poly = MultivariatePolynomial<mpq_class>;
+
+	template<template<typename, template<typename> class> class Procedure>
+	std::size_t groebnerTime(const std::string& name, const std::vector<Poly>& input, std::size_t threads = 1) {
+		carl::Timer timer;
+		GBProcedure<Poly, Procedure, StdAdding> gb;
+		gb.procedure().setThreads(threads);
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.calculate();
+		std::cout << name << ": " << gb.getBasisPolynomials().size() << " polynomials, " << timer.passed() << " ms" << std::endl;
+		return timer.passed();
+	}
+
+	std::size_t signatureTime(const std::vector<Poly>& input) {
+		carl::Timer timer;
+		GBProcedure<Poly, F5C, StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.calculate();
+		std::cout << "F5C: " << gb.getBasisPolynomials().size() << " polynomials, " << timer.passed() << " ms" << std::endl;
+		std::cout << gb.procedure().statistics();
+		return timer.passed();
+	}
+
+	std::size_t modularTime(const std::vector<Poly>& input, std::size_t threads) {
+		carl::Timer timer;
+		ModularGroebner<Poly> modular;
+		modular.settings().threads = threads;
+		auto basis = modular.calculate(input);
+		std::cout << "Modular (" << threads << " threads): " << (basis ? basis->size() : 0) << " polynomials, " << modular.statistics().primes << " primes, " << timer.passed() << " ms" << std::endl;
+		return timer.passed();
+	}
+
+	template<template<class> class Datastructure>
+	std::size_t reductionTime(const std::string& name, const Ideal<Poly>& ideal, const std::vector<Poly>& polynomials) {
+		carl::Timer timer;
+		std::size_t terms = 0;
+		for (const auto& p: polynomials) {
+			Reductor<Poly, Poly, Datastructure> reductor(ideal, p);
+			terms += reductor.fullReduce().nrTerms();
+		}
+		std::cout << name << ": " << terms << " remainder terms, " << timer.passed() << " ms" << std::endl;
+		return timer.passed();
+	}
+
+	/// Reduces products of three input polynomials plus a product of leading terms by the Groebner basis.
+	BenchmarkResult compareReduction(const std::vector<Poly>& input) {
+		GBProcedure<Poly, F4, StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.calculate();
+		Ideal<Poly> ideal;
+		for (const auto& g: gb.getBasisPolynomials()) ideal.addGenerator(g);
+		std::vector<Poly> polynomials;
+		for (const auto& p: input) {
+			for (const auto& q: input) {
+				for (const auto& r: input) polynomials.push_back(p * q * r + Poly(p.lterm()) * Poly(q.lterm()));
+			}
+		}
+		BenchmarkResult res;
+		res["Heap"] = reductionTime<Heap>("Heap", ideal, polynomials);
+		res["Geobucket"] = reductionTime<Geobucket>("Geobucket", ideal, polynomials);
+		return res;
+	}
+
+	BenchmarkResult compare(const std::vector<Poly>& input) {
+		BenchmarkResult res;
+		res["Buchberger"] = groebnerTime<Buchberger>("Buchberger", input);
+		res["BuchbergerParallel"] = groebnerTime<Buchberger>("Buchberger (" + std::to_string(std::thread::hardware_concurrency()) + " threads)", input, std::thread::hardware_concurrency());
+		res["F4"] = groebnerTime<F4>("F4", input);
+		res["F5C"] = signatureTime(input);
+		res["Modular"] = modularTime(input, 1);
+		res["Parallel"] = modularTime(input, std::thread::hardware_concurrency());
+		return res;
+	}
+}
+
+TEST_F(BenchmarkTest, GroebnerCyclic)
+{
+	for (unsigned n = 2; n <= 4; n++) {
+		file.push(compare(carl::benchmarks::cyclic<mpq_class, NotRelevant, StdMultivariatePolynomialPolicies<>>(n)), n);
+	}
+}
+
+TEST_F(BenchmarkTest, GroebnerKatsura)
+{
+	for (unsigned n = 2; n <= 5; n++) {
+		file.push(compare(carl::benchmarks::katsura<mpq_class, NotRelevant, StdMultivariatePolynomialPolicies<>>(n)), n);
+	}
+}
+
+TEST_F(BenchmarkTest, GroebnerReductionCyclic)
+{
+	for (unsigned n = 2; n <= 4; n++) {
+		file.push(compareReduction(carl::benchmarks::cyclic<mpq_class, NotRelevant, StdMultivariatePolynomialPolicies<>>(n)), n);
+	}
+}
+
+TEST_F(BenchmarkTest, GroebnerReductionKatsura)
+{
+	for (unsigned n = 2; n <= 5; n++) {
+		file.push(compareReduction(carl::benchmarks::katsura<mpq_class, NotRelevant, StdMultivariatePolynomialPolicies<>>(n)), n);
+	}
+}
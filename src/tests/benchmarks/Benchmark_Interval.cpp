@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/CenteredEvaluation.h"
+#include "carl/interval/Interval.h"
+#include "carl/interval/NativeInterval.h"
+#include "carl/util/Timer.h"
+#include "BenchmarkTest.h"
+
+#include <random>
+
+using namespace carl;
+
+namespace {
+	/**
+	 * Generates random pairs of intervals, the second one not containing zero such that it can be used as divisor.
+	 */
+	std::vector<std::pair<Interval<double>,Interval<double>>> randomIntervals(std::size_t n) {
+		std::mt19937 rand(4);
+		std::uniform_real_distribution<double> dist(-100, 100);
+		std::uniform_real_distribution<double> width(0, 10);
+		std::vector<std::pair<Interval<double>,Interval<double>>> res;
+		for (std::size_t i = 0; i < n; i++) {
+			double l1 = dist(rand);
+			double l2 = std::abs(dist(rand)) + 1;
+			if (i % 2 == 0) l2 = -l2 - 10;
+			res.emplace_back(
+				Interval<double>(l1, BoundType::WEAK, l1 + width(rand), BoundType::WEAK),
+				Interval<double>(l2, BoundType::WEAK, l2 + width(rand) / 2, BoundType::WEAK)
+			);
+		}
+		return res;
+	}
+
+	/// Applies op to all pairs and returns the elapsed time.
+	template<typename I, typename Operation>
+	std::size_t run(const std::vector<std::pair<I,I>>& input, Operation&& op) {
+		carl::Timer timer;
+		double checksum = 0;
+		for (std::size_t rep = 0; rep < 10; rep++) {
+			for (const auto& in: input) {
+				checksum += op(in.first, in.second).upper();
+			}
+		}
+		std::size_t time = timer.passed();
+		// Make sure that the computation is not optimized away.
+		if (checksum == 0.5) std::cout << checksum << std::endl;
+		return time;
+	}
+
+	template<typename Operation>
+	void compare(BenchmarkFile<std::size_t>& file, Operation&& op) {
+		for (std::size_t n = 100000; n <= 400000; n += 100000) {
+			auto input = randomIntervals(n);
+			std::vector<std::pair<NativeInterval,NativeInterval>> native;
+			for (const auto& in: input) {
+				native.emplace_back(NativeInterval(in.first), NativeInterval(in.second));
+			}
+			BenchmarkResult res;
+			res["Interval"] = run(input, op);
+			res["NativeInterval"] = run(native, op);
+			std::cout << n << ": Interval " << res["Interval"] << " ms, NativeInterval " << res["NativeInterval"] << " ms" << std::endl;
+			file.push(res, n);
+		}
+	}
+}
+
+TEST_F(BenchmarkTest, IntervalAddition)
+{
+	compare(file, [](const auto& a, const auto& b){ return a + b; });
+}
+
+TEST_F(BenchmarkTest, IntervalMultiplication)
+{
+	compare(file, [](const auto& a, const auto& b){ return a * b; });
+}
+
+TEST_F(BenchmarkTest, IntervalDivision)
+{
+	compare(file, [](const auto& a, const auto& b){ return a / b; });
+}
+
+TEST_F(BenchmarkTest, IntervalPower)
+{
+	compare(file, [](const auto& a, const auto&){ return a.pow(5); });
+}
+
+TEST_F(BenchmarkTest, IntervalEvaluationForms)
+{
+	using Poly = MultivariatePolynomial<mpq_class>;
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly p = (Poly(x)*x - Poly(y)*z) * (Poly(x)*y + Poly(z)*z - Poly(x)) + mpq_class(3)*x*y*z - mpq_class(1);
+	std::mt19937 rand(4);
+	std::uniform_real_distribution<double> dist(-2, 2);
+	std::vector<std::pair<double,double>> centers;
+	for (std::size_t i = 0; i < 3000; i++) centers.emplace_back(dist(rand), dist(rand));
+
+	std::size_t id = 0;
+	for (double radius: {0.001, 0.01, 0.1, 1.0}) {
+		std::vector<IntervalBox<double>> boxes;
+		for (const auto& c: centers) {
+			IntervalBox<double> box;
+			box.set(x, Interval<double>(c.first - radius, BoundType::WEAK, c.first + radius, BoundType::WEAK));
+			box.set(y, Interval<double>(c.second - radius, BoundType::WEAK, c.second + radius, BoundType::WEAK));
+			box.set(z, Interval<double>(c.first * c.second - radius, BoundType::WEAK, c.first * c.second + radius, BoundType::WEAK));
+			boxes.push_back(box);
+		}
+		BenchmarkResult res;
+		std::cout << "radius " << radius << ":";
+		for (auto form: {IntervalEvaluationForm::Natural, IntervalEvaluationForm::MeanValue, IntervalEvaluationForm::Centered, IntervalEvaluationForm::Taylor}) {
+			CenteredEvaluation<Poly> eval(p);
+			double width = 0;
+			carl::Timer timer;
+			for (const auto& box: boxes) {
+				width += eval.evaluate(box, form).diameter();
+			}
+			std::stringstream ss;
+			ss << form;
+			// Time in microseconds per evaluation and the average width in percent of the box width.
+			res[ss.str() + "Time"] = timer.passed() * 1000 / boxes.size();
+			res[ss.str() + "Width"] = static_cast<std::size_t>(100 * width / boxes.size() / (2 * radius));
+			std::cout << " " << form << " " << res[ss.str() + "Time"] << " us, width " << width / boxes.size();
+		}
+		std::cout << std::endl;
+		file.push(res, id++);
+	}
+}
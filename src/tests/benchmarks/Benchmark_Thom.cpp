@@ -0,0 +1,49 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/thom/ThomRootFinder.h"
+#include "carl/util/Timer.h"
+#include "BenchmarkTest.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace carl;
+
+namespace {
+	using Poly = MultivariatePolynomial<mpq_class>;
+
+	/**
+	 * Isolates the roots 1, ..., n of (x-1)*...*(x-n) and lifts each of them to the three roots of y^3 - 3y + x - (n+1)/2.
+	 */
+	std::size_t rootFinderTime(unsigned n, std::size_t threads) {
+		TarskiQueryManager<mpq_class>::setDefaultThreads(threads);
+		Variable x = freshRealVariable();
+		Variable y = freshRealVariable();
+		carl::Timer timer;
+		Poly p(1);
+		for (unsigned i = 1; i <= n; i++) p *= Poly(x) - Poly(mpq_class(i));
+		Poly q = Poly(y) * y * y - Poly(mpq_class(3)) * y + Poly(x) - Poly(mpq_class(n + 1, 2));
+		std::size_t roots = 0;
+		for (const auto& r: realRootsThom(p, x)) {
+			std::map<Variable, ThomEncoding<mpq_class>> point;
+			point.emplace(x, r);
+			roots += realRootsThom(q, y, point).size();
+		}
+		std::cout << "Thom (" << threads << " threads): " << roots << " roots, " << timer.passed() << " ms" << std::endl;
+		TarskiQueryManager<mpq_class>::setDefaultThreads(1);
+		return timer.passed();
+	}
+}
+
+TEST_F(BenchmarkTest, ThomRootFinder)
+{
+	std::size_t maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	for (unsigned n = 2; n <= 5; n++) {
+		BenchmarkResult res;
+		for (std::size_t threads = 1; threads <= maxThreads; threads++) {
+			res[std::to_string(threads) + " threads"] = rootFinderTime(n, threads);
+		}
+		file.push(res, n);
+	}
+}
@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/CompiledHorner.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/IntervalEvaluation.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+struct CompiledHornerTest: ::testing::Test {
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	Poly p = Rational(3)*x*x*y + Rational(2)*x*y*z - Poly(z)*z*z + Rational(5)*y - Rational(1, 2);
+};
+
+TEST_F(CompiledHornerTest, Evaluation)
+{
+	MultivariateHorner<Poly, strategy> horner(p);
+	CompiledHorner<Poly> compiled(horner);
+	EXPECT_EQ(std::size_t(3), compiled.variables().size());
+
+	std::map<Variable, Rational> point = {{x, Rational(1, 3)}, {y, Rational(-2)}, {z, Rational(7, 5)}};
+	EXPECT_EQ(p.evaluate(point), compiled.evaluate(point));
+
+	std::map<Variable, double> dpoint = {{x, 0.5}, {y, -2.0}, {z, 1.5}};
+	EXPECT_NEAR(3*0.25*-2.0 + 2*0.5*-2.0*1.5 - 1.5*1.5*1.5 + 5*-2.0 - 0.5, compiled.evaluate(dpoint), 1e-12);
+
+	Interval<double>::evalintervalmap box = {{x, Interval<double>(-1.0, 2.0)}, {y, Interval<double>(0.5, 1.0)}, {z, Interval<double>(-3.0, 0.0)}};
+	EXPECT_EQ(IntervalEvaluation::evaluate(horner, box), compiled.evaluate(box));
+	EXPECT_EQ(compiled.evaluate(box), compiled.evaluate(IntervalBox<double>(box)));
+
+	CompiledHorner<Poly> constant(Poly(Rational(4)));
+	EXPECT_EQ(Rational(4), constant.evaluate(std::map<Variable, Rational>()));
+}
+
+TEST_F(CompiledHornerTest, Cache)
+{
+	auto& cache = HornerSchemeCache<Poly>::getInstance();
+	cache.clear();
+	cache.setMaxSize(2);
+	auto s1 = cache.get(p);
+	EXPECT_EQ(s1, cache.get(p));
+	EXPECT_EQ(std::size_t(1), cache.hits());
+	EXPECT_EQ(std::size_t(1), cache.misses());
+	cache.get(p + x);
+	cache.get(p);
+	// p + y evicts the least recently used entry p + x.
+	cache.get(p + y);
+	EXPECT_EQ(std::size_t(2), cache.size());
+	EXPECT_EQ(s1, cache.get(p));
+	EXPECT_EQ(std::size_t(3), cache.misses());
+	cache.get(p + x);
+	EXPECT_EQ(std::size_t(4), cache.misses());
+	// Dropped schemes stay valid.
+	cache.clear();
+	std::map<Variable, Rational> point = {{x, Rational(1)}, {y, Rational(2)}, {z, Rational(3)}};
+	EXPECT_EQ(p.evaluate(point), s1->evaluate(point));
+	cache.setMaxSize(1024);
+}
@@ -0,0 +1,321 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/groebner/groebner.h"
+#include "carl/groebner/benchmarks/cyclic.h"
+#include "carl/groebner/benchmarks/katsura.h"
+#include "carl/thom/TarskiQuery/GroebnerBase.h"
+#include "carl/thom/TarskiQuery/TarskiQueryManager.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+
+namespace {
+	template<template<typename, template<typename> class> class Procedure>
+	std::vector<Pol> reducedBasis(const std::vector<Pol>& input) {
+		GBProcedure<Pol, Procedure, StdAdding> gb;
+		for (const auto& p: input) gb.addPolynomial(p);
+		gb.calculate();
+		std::vector<Pol> res = gb.getBasisPolynomials();
+		std::sort(res.begin(), res.end(), Pol::compareByLeadingTerm);
+		return res;
+	}
+}
+
+TEST(Groebner, F4Cyclic)
+{
+	auto input = carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3);
+	EXPECT_EQ(reducedBasis<Buchberger>(input), reducedBasis<F4>(input));
+}
+
+TEST(Groebner, F4Katsura)
+{
+	for (unsigned n = 2; n <= 4; n++) {
+		auto input = carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(n);
+		EXPECT_EQ(reducedBasis<Buchberger>(input), reducedBasis<F4>(input));
+	}
+}
+
+TEST(Groebner, F4Cyclic4)
+{
+	auto input = carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4);
+	EXPECT_EQ(reducedBasis<Buchberger>(input), reducedBasis<F4>(input));
+}
+
+TEST(Groebner, F4Incremental)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	GBProcedure<Pol, F4, StdAdding> gb;
+	gb.addPolynomial(px*px - py);
+	gb.calculate();
+	EXPECT_EQ(1, gb.getBasisPolynomials().size());
+
+	gb.addPolynomial(px*py - Pol(1));
+	EXPECT_TRUE(gb.reduceInput().empty());
+	gb.calculate();
+	EXPECT_FALSE(gb.basisIsConstant());
+	std::vector<Pol> basis = gb.getBasisPolynomials();
+	std::sort(basis.begin(), basis.end(), Pol::compareByLeadingTerm);
+	EXPECT_EQ(reducedBasis<Buchberger>({px*px - py, px*py - Pol(1)}), basis);
+
+	// x = -1 implies y = 1 and hence x*y = -1.
+	gb.addPolynomial(px + Pol(1));
+	gb.calculate();
+	EXPECT_TRUE(gb.basisIsConstant());
+}
+
+TEST(Groebner, ParallelBuchberger)
+{
+	std::vector<std::vector<Pol>> inputs = {
+		carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4),
+		carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for (const auto& input: inputs) {
+		std::vector<Pol> sequential = reducedBasis<Buchberger>(input);
+		for (std::size_t threads: {2, 4}) {
+			GBProcedure<Pol, Buchberger, StdAdding> gb;
+			gb.procedure().setThreads(threads);
+			for (const auto& p: input) gb.addPolynomial(p);
+			gb.calculate();
+			std::vector<Pol> basis = gb.getBasisPolynomials();
+			std::sort(basis.begin(), basis.end(), Pol::compareByLeadingTerm);
+			EXPECT_EQ(sequential, basis);
+		}
+	}
+}
+
+TEST(Groebner, IdealTrie)
+{
+	auto input = carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3);
+	Ideal<Pol> vector;
+	Ideal<Pol, IdealDatastructureTrie> trie;
+	for (const auto& g: reducedBasis<Buchberger>(input)) {
+		vector.addGenerator(g);
+		trie.addGenerator(g);
+	}
+	for (const auto& p: input) {
+		for (const auto& q: input) {
+			Reductor<Pol, Pol> vectorReductor(vector, p * q + p);
+			Reductor<Pol, Pol, Heap, ReductorConfiguration, IdealDatastructureTrie> trieReductor(trie, p * q + p);
+			EXPECT_EQ(vectorReductor.fullReduce(), trieReductor.fullReduce());
+		}
+	}
+	const auto& statistics = trie.divisorLookup().statistics();
+	EXPECT_LT(0, statistics.lookups);
+	EXPECT_LT(0, statistics.rejected);
+	EXPECT_LT(0, statistics.tested);
+
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Ideal<Pol, IdealDatastructureTrie> ideal;
+	ideal.addGenerator(Pol(x) * Pol(x) - Pol(1));
+	EXPECT_FALSE(ideal.getDivisor(Term<Rational>(Rational(1), y, 1)).success());
+	// Adds a new variable, hence the trie is rebuilt.
+	ideal.addGenerator(Pol(y) - Pol(x));
+	auto divres = ideal.getDivisor((Rational(2) * Pol(x) * Pol(y) * Pol(y)).lterm());
+	ASSERT_TRUE(divres.success());
+	EXPECT_EQ(Pol(y) - Pol(x), *divres.mDivisor);
+	EXPECT_EQ((Rational(-2) * Pol(x) * Pol(y)).lterm(), divres.mFactor);
+}
+
+TEST(Groebner, Geobucket)
+{
+	auto input = carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3);
+	Ideal<Pol> ideal;
+	for (const auto& g: reducedBasis<Buchberger>(input)) ideal.addGenerator(g);
+	for (const auto& p: input) {
+		for (const auto& q: input) {
+			Reductor<Pol, Pol> heap(ideal, p * q - q);
+			Reductor<Pol, Pol, Geobucket> geobucket(ideal, p * q - q);
+			EXPECT_EQ(heap.fullReduce(), geobucket.fullReduce());
+		}
+		// Every input polynomial is in the ideal.
+		Reductor<Pol, Pol, Geobucket> geobucket(ideal, p);
+		EXPECT_TRUE(geobucket.fullReduce().isZero());
+	}
+}
+
+TEST(Groebner, F5C)
+{
+	std::vector<std::vector<Pol>> inputs = {
+		carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3),
+		carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4),
+		carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3),
+		carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for (const auto& input: inputs) {
+		EXPECT_EQ(reducedBasis<Buchberger>(input), reducedBasis<F5C>(input));
+	}
+
+	GBProcedure<Pol, F5C, StdAdding> gb;
+	for (const auto& p: inputs[1]) gb.addPolynomial(p);
+	gb.calculate();
+	const auto& statistics = gb.procedure().statistics();
+	EXPECT_LT(0, statistics.avoidedReductions());
+	EXPECT_EQ(statistics.pairs, statistics.avoidedReductions() + statistics.reductions - inputs[1].size());
+}
+
+TEST(Groebner, F5CIncremental)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	GBProcedure<Pol, F5C, StdAdding> gb;
+	gb.addPolynomial(px*px - py);
+	gb.calculate();
+	EXPECT_EQ(1, gb.getBasisPolynomials().size());
+
+	gb.addPolynomial(px*py - Pol(1));
+	gb.calculate();
+	EXPECT_FALSE(gb.basisIsConstant());
+	std::vector<Pol> basis = gb.getBasisPolynomials();
+	std::sort(basis.begin(), basis.end(), Pol::compareByLeadingTerm);
+	EXPECT_EQ(reducedBasis<Buchberger>({px*px - py, px*py - Pol(1)}), basis);
+
+	// x = -1 implies y = 1 and hence x*y = -1.
+	gb.addPolynomial(px + Pol(1));
+	gb.calculate();
+	EXPECT_TRUE(gb.basisIsConstant());
+}
+
+TEST(Groebner, FGLM)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	std::vector<Pol> input = {px*px + py*py - Pol(5), px*py - Pol(2)};
+	GroebnerBase<Rational> gb(input.begin(), input.end());
+	std::vector<Pol> expected = {py*py*py*py - Rational(5)*py*py + Pol(4), px + Rational(1, 2)*py*py*py - Rational(5, 2)*py};
+	EXPECT_EQ(expected, gb.lexBase({x, y}));
+
+	auto katsura = carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3);
+	GroebnerBase<Rational> graded(katsura.begin(), katsura.end());
+	std::set<Variable> variables = graded.gatherVariables();
+	std::vector<Pol> lex = graded.lexBase(std::vector<Variable>(variables.begin(), variables.end()));
+	ASSERT_FALSE(lex.empty());
+	// The first polynomial only contains the smallest variable, its degree is the number of solutions.
+	EXPECT_TRUE(lex.front().isUnivariate());
+	EXPECT_EQ(*variables.rbegin(), lex.front().getSingleVariable());
+	EXPECT_EQ(graded.mon().size(), lex.front().totalDegree());
+	for (const auto& p: lex) {
+		EXPECT_TRUE(graded.reduce(p).isZero());
+	}
+}
+
+TEST(Groebner, MultiplicationMatrices)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	std::vector<Pol> input = {px*px + py*py - Pol(5), px*py - Pol(2)};
+	GroebnerBase<Rational> gb(input.begin(), input.end());
+	MultiplicationTable<Rational> table(gb);
+	const auto& base = table.getBase();
+	for (Variable var: {x, y}) {
+		const SparseMatrix<Rational>* matrix = table.multiplicationMatrix(var);
+		ASSERT_NE(nullptr, matrix);
+		for (std::size_t j = 0; j < base.size(); j++) {
+			std::vector<Rational> unit(base.size(), Rational(0));
+			unit[j] = Rational(1);
+			EXPECT_EQ(table.reduce(Pol(var) * Pol(base[j])).toDense(base.size()), matrix->multiply(unit));
+		}
+	}
+	EXPECT_EQ(Rational(base.size()), table.trace(table.reduce(Pol(1))));
+
+	// The solutions are (1,2), (2,1), (-1,-2) and (-2,-1).
+	TarskiQueryManager<Rational> taq(input.begin(), input.end());
+	EXPECT_EQ(4, taq(Pol(1)));
+	EXPECT_EQ(0, taq(px));
+	EXPECT_EQ(-2, taq(px - Rational(3, 2)));
+	EXPECT_EQ(-1, taq(px*px*px - Pol(1)));
+	EXPECT_EQ(-1, multivariateTarskiQuery(px*px*px - Pol(1), table));
+}
+
+TEST(Groebner, TarskiQueryBatch)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	std::vector<Pol> input = {px*px + py*py - Pol(5), px*py - Pol(2)};
+	std::vector<Pol> queries = {Pol(1), px, py, px - Rational(3, 2), px*px*px - Pol(1), px*py*py, py - px};
+	TarskiQueryManager<Rational> sequential(input.begin(), input.end());
+	std::vector<int> expected;
+	for (const auto& q: queries) expected.push_back(sequential(q));
+	EXPECT_EQ(expected, sequential(queries.begin(), queries.end()));
+
+	TarskiQueryManager<Rational> parallel(input.begin(), input.end());
+	parallel.setThreads(4);
+	EXPECT_EQ(expected, parallel(queries.begin(), queries.end()));
+	// Copies share the cache with the original manager.
+	TarskiQueryManager<Rational> copy(parallel);
+	EXPECT_EQ(expected, copy(queries.begin(), queries.end()));
+}
+
+TEST(Groebner, RationalReconstruction)
+{
+	mpz_class m = mpz_class(1000003) * mpz_class(1000033);
+	// a = -355 / 113 mod m
+	mpz_class inv;
+	mpz_class den(113);
+	mpz_invert(inv.get_mpz_t(), den.get_mpz_t(), m.get_mpz_t());
+	mpz_class a = carl::mod(mpz_class(-355 * inv), m);
+	auto r = modular_groebner::rationalReconstruction<mpz_class, Rational>(a, m);
+	ASSERT_TRUE(bool(r));
+	EXPECT_EQ(Rational(-355, 113), *r);
+	// Numerator and denominator are too large for the modulus.
+	EXPECT_FALSE(bool(modular_groebner::rationalReconstruction<mpz_class, Rational>(mpz_class("123456789012"), m)));
+}
+
+TEST(Groebner, Modular)
+{
+	std::vector<std::vector<Pol>> inputs = {
+		carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3),
+		carl::benchmarks::cyclic<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4),
+		carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(3),
+		carl::benchmarks::katsura<Rational, NotRelevant, StdMultivariatePolynomialPolicies<>>(4)
+	};
+	for (auto& input: inputs) {
+		for (auto& p: input) p *= Rational(2, 7);
+		ModularGroebner<Pol> modular;
+		auto basis = modular.calculate(input);
+		ASSERT_TRUE(bool(basis));
+		std::sort(basis->begin(), basis->end(), Pol::compareByLeadingTerm);
+		EXPECT_EQ(reducedBasis<F4>(input), *basis);
+		EXPECT_EQ(0, modular.statistics().failedVerifications);
+
+		modular.settings().threads = 3;
+		auto parallel = modular.calculate(input);
+		ASSERT_TRUE(bool(parallel));
+		std::sort(parallel->begin(), parallel->end(), Pol::compareByLeadingTerm);
+		EXPECT_EQ(*basis, *parallel);
+	}
+}
+
+TEST(Groebner, ModularProcedure)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Pol px(x);
+	Pol py(y);
+	GBProcedure<Pol, Modular, StdAdding> gb;
+	gb.addPolynomial(px*px - Rational(1, 3) * py);
+	gb.addPolynomial(px*py - Pol(1));
+	gb.calculate();
+	std::vector<Pol> basis = gb.getBasisPolynomials();
+	std::sort(basis.begin(), basis.end(), Pol::compareByLeadingTerm);
+	EXPECT_EQ(reducedBasis<Buchberger>({px*px - Rational(1, 3) * py, px*py - Pol(1)}), basis);
+
+	gb.addPolynomial(px + Pol(1));
+	gb.calculate();
+	EXPECT_TRUE(gb.basisIsConstant());
+}
@@ -6,6 +6,34 @@
 
 #include "../Common.h"
 
+TEST(LazardEvaluation, LevelReduction)
+{
+	using Poly = carl::MultivariatePolynomial<Rational>;
+	using Reduction = carl::detail_lazard::LevelReduction<Poly>;
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::Variable y = carl::freshRealVariable("y");
+	carl::Variable z = carl::freshRealVariable("z");
+	carl::Variable w = carl::freshRealVariable("w");
+
+	// x = sqrt(2), followed by the rational y = 1 and the linear z = x + 1.
+	Reduction sqrt2 = Reduction::extension(x, Poly(x)*x - Poly(2));
+	Reduction one = Reduction::substitution(y, Poly(1));
+	Reduction linear = Reduction::substitution(z, Poly(x) + Poly(1));
+	EXPECT_FALSE(sqrt2.substitute);
+	EXPECT_TRUE(one.substitute);
+
+	// (x^2 - 2y) * w reduces to (2 - 2y) * w, which vanishes for y = 1.
+	Poly p = (Poly(x)*x - Poly(2)*y) * w;
+	Poly r = sqrt2.apply(p);
+	EXPECT_EQ(Poly(2)*w - Poly(2)*y*w, r);
+	EXPECT_EQ(Poly(-2)*w, one.apply(r));
+
+	// (z - x - 1) * w vanishes for z = x + 1.
+	Poly q = (Poly(z) - Poly(x) - Poly(1)) * w;
+	EXPECT_EQ(q, sqrt2.apply(q));
+	EXPECT_EQ(Poly(w), linear.apply(q));
+}
+
 #ifdef USE_COCOA
 TEST(LazardEvaluation, Test)
 {
@@ -123,4 +151,47 @@ TEST_F(LazardTest, Proper3) {
 	EXPECT_EQ(-Poly(z), le.getLiftingPoly());
 }
 
+TEST_F(LazardTest, RationalAfterIrrational) {
+	auto ax = getRAN({-2, 0, 1}, 1, 2);
+	auto ay = carl::RealAlgebraicNumber<Rational>(Rational(1));
+	auto az = getRAN({-2, 0, 1}, 1, 2);
+	auto q = (Poly(x)*x - Poly(2)*y) * (Poly(z) - x) * (Poly(z) + Poly(1));
+
+	carl::LazardEvaluation<Rational,Poly> le(q);
+	le.substitute(x, ax);
+	// The rational y = 1 after the field extension for x.
+	le.substitute(y, ay);
+	EXPECT_EQ(Poly(-2) * (Poly(z) - x) * (Poly(z) + Poly(1)), le.getLiftingPoly());
+	// The linear z = x after the field extension for x.
+	le.substitute(z, az);
+	EXPECT_EQ(Poly(-2)*x - Poly(2), le.getLiftingPoly());
+}
+
+TEST_F(LazardTest, Context) {
+	auto ax = getRAN({-2, 0, 1}, 1, 2);
+	auto ay1 = getRAN({-2, 0, 1}, 1, 2);
+	auto ay2 = getRAN({-2, 0, 1}, -2, -1);
+	auto q = (Poly(x)-y)*z;
+
+	carl::LazardLiftingContext<Rational,Poly> root;
+	auto cx = root.extend(x, ax);
+	// Both samples share the level for x.
+	auto c1 = cx.extend(y, ay1);
+	auto c2 = cx.extend(y, ay2);
+	EXPECT_EQ(std::size_t(2), c1.depth());
+	EXPECT_TRUE(c1.parent() == cx);
+	EXPECT_TRUE(c2.parent() == cx);
+
+	carl::LazardEvaluation<Rational,Poly> le1(q);
+	le1.substitute(x, ax);
+	le1.substitute(y, ay1);
+	EXPECT_EQ(-Poly(z), c1.reduce(q));
+	EXPECT_EQ(le1.getLiftingPoly(), c1.reduce(q));
+
+	carl::LazardEvaluation<Rational,Poly> le2(q, cx);
+	le2.substitute(y, ay2);
+	EXPECT_EQ(Poly(2)*x*z, le2.getLiftingPoly());
+	EXPECT_EQ(le2.getLiftingPoly(), c2.reduce(q));
+}
+
 #endif
@@ -0,0 +1,66 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/FactorizedPolynomial.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/PolynomialPool.h"
+#include "carl/formula/Constraint.h"
+
+#include "../Common.h"
+
+#include <unordered_map>
+
+using namespace carl;
+
+typedef MultivariatePolynomial<Rational> Pol;
+
+TEST(PolynomialPool, HashConsing)
+{
+	PolynomialPool<Pol>& pool = PolynomialPool<Pol>::getInstance();
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	std::size_t size = pool.size();
+	{
+		PooledPolynomial<Pol> p1(Pol(x) * y + Pol(1));
+		PooledPolynomial<Pol> p2(Pol(1) + Pol(y) * x);
+		PooledPolynomial<Pol> p3(Pol(x) * y - Pol(1));
+		EXPECT_EQ(p1, p2);
+		EXPECT_EQ(&*p1, &*p2);
+		EXPECT_EQ(p1.id(), p2.id());
+		EXPECT_NE(p1, p3);
+		EXPECT_EQ(std::hash<Pol>()(Pol(x) * y + Pol(1)), p1.hash());
+		EXPECT_EQ(Pol(x) * y - Pol(1), *p3);
+		EXPECT_EQ(size + 2, pool.size());
+
+		std::unordered_map<PooledPolynomial<Pol>, int> map;
+		map[p1] = 1;
+		map[p3] = 3;
+		EXPECT_EQ(1, map[p2]);
+		EXPECT_EQ(2, map.size());
+	}
+	// The polynomials are removed as soon as the last handle is gone.
+	EXPECT_EQ(size, pool.size());
+	EXPECT_FALSE(PooledPolynomial<Pol>());
+}
+
+TEST(PolynomialPool, FactorizedPolynomial)
+{
+	typedef FactorizedPolynomial<Pol> FPol;
+	Variable x = freshRealVariable("x");
+	std::shared_ptr<Cache<PolynomialFactorizationPair<Pol>>> cache(new Cache<PolynomialFactorizationPair<Pol>>());
+	FPol f1(Pol(x) * x - Pol(1), cache);
+	FPol f2(Pol(x) * x - Pol(1), cache);
+	EXPECT_EQ(PooledPolynomial<FPol>(f1), PooledPolynomial<FPol>(f2));
+	EXPECT_NE(PooledPolynomial<FPol>(f1), PooledPolynomial<FPol>(FPol(Pol(x), cache)));
+}
+
+TEST(PolynomialPool, Constraint)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Constraint<Pol> c1(Pol(x) + y - Pol(1), Relation::LEQ);
+	Constraint<Pol> c2(Pol(x) + y - Pol(1), Relation::EQ);
+	Constraint<Pol> c3(Pol(x) - y, Relation::EQ);
+	EXPECT_EQ(c1.pooledLhs(), c2.pooledLhs());
+	EXPECT_NE(c1.pooledLhs(), c3.pooledLhs());
+	EXPECT_EQ(c1.lhs(), *c1.pooledLhs());
+}
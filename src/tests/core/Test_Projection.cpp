@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "carl/cad/Projection.h"
+#include "carl/core/MultivariatePolynomial.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+struct ProjectionTest: ::testing::Test {
+	// Taken from "Improved Projection for Cylindrical Algebraic Decomposition", Figure 1
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p1 = Poly(x)*x + Poly(y)*y - Poly(4);
+	Poly p2 = Poly(x)*y - Poly(1);
+};
+
+TEST_F(ProjectionTest, McCallum)
+{
+	cad::Projection<Poly> proj({x, y}, cad::ProjectionType::McCallum);
+	proj.addPolynomial(p1);
+	proj.addPolynomial(p2);
+	proj.project();
+	EXPECT_EQ(std::size_t(2), proj.polynomials(1).size());
+	EXPECT_TRUE(proj.contains(p1));
+	EXPECT_TRUE(proj.contains(p2));
+	// Leading coefficient of p2 and resultant of p1 and p2.
+	EXPECT_TRUE(proj.contains(Poly(x)));
+	EXPECT_TRUE(proj.contains(Poly(x)*x*x*x - Poly(4)*x*x + Poly(1)));
+	for (const auto& p: proj.polynomials(0)) {
+		EXPECT_EQ(x, p.mainVar());
+		EXPECT_TRUE(p.isUnivariate());
+	}
+	EXPECT_EQ(std::size_t(1), proj.resultants());
+	EXPECT_EQ(std::size_t(1), proj.discriminants());
+}
+
+TEST_F(ProjectionTest, Lazard)
+{
+	cad::Projection<Poly> mccallum({x, y}, cad::ProjectionType::McCallum);
+	cad::Projection<Poly> lazard({x, y}, cad::ProjectionType::Lazard);
+	for (auto* proj: {&mccallum, &lazard}) {
+		proj->addPolynomial(p1);
+		proj->addPolynomial(p2);
+		proj->project();
+	}
+	// The trailing coefficient x^2 - 4 of p1 is also a factor of its discriminant, hence both projections coincide.
+	EXPECT_EQ(mccallum.size(), lazard.size());
+	for (const auto& p: mccallum.polynomials(0)) {
+		EXPECT_TRUE(lazard.contains(Poly(p)));
+	}
+}
+
+TEST_F(ProjectionTest, Incremental)
+{
+	Variable z = freshRealVariable("z");
+	Poly p3 = Poly(z)*z - Poly(x)*y;
+	cad::Projection<Poly> all({x, y, z});
+	all.addPolynomial(p1);
+	all.addPolynomial(p2);
+	all.addPolynomial(p3);
+	all.project();
+
+	cad::Projection<Poly> incremental({x, y, z});
+	incremental.addPolynomial(p3);
+	incremental.project();
+	std::size_t resultants = incremental.resultants();
+	incremental.addPolynomial(p1);
+	incremental.addPolynomial(p2);
+	// Adding a known polynomial does not change anything.
+	incremental.addPolynomial(p3);
+	incremental.project();
+	EXPECT_EQ(all.size(), incremental.size());
+	EXPECT_EQ(all.resultants(), incremental.resultants());
+	EXPECT_LT(resultants, incremental.resultants());
+	for (std::size_t level = 0; level < 3; level++) {
+		EXPECT_EQ(all.polynomials(level).size(), incremental.polynomials(level).size());
+		for (const auto& p: all.polynomials(level)) {
+			EXPECT_TRUE(incremental.contains(Poly(p)));
+		}
+	}
+}
+
+TEST_F(ProjectionTest, Parallel)
+{
+	Variable z = freshRealVariable("z");
+	Poly p3 = Poly(z)*z*x - Poly(y) + Poly(x)*z;
+	cad::Projection<Poly> sequential({x, y, z});
+	cad::Projection<Poly> parallel({x, y, z});
+	parallel.setThreads(4);
+	for (auto* proj: {&sequential, &parallel}) {
+		proj->addPolynomial(p1);
+		proj->addPolynomial(p2);
+		proj->addPolynomial(p3);
+		proj->project();
+	}
+	for (std::size_t level = 0; level < 3; level++) {
+		EXPECT_EQ(sequential.polynomials(level), parallel.polynomials(level));
+	}
+}
@@ -42,3 +42,31 @@ TEST(Resultant, det)
     //EXPECT_EQ(r3, r1);
     //EXPECT_EQ(r3, r2);
 }
+
+TEST(Resultant, Modular)
+{
+	Variable x = freshRealVariable("x");
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	using MP = MultivariatePolynomial<Rational>;
+	using UP = UnivariatePolynomial<MP>;
+	MP ma(a);
+	MP mb(b);
+
+	std::vector<std::pair<UP,UP>> inputs = {
+		// Circle and line
+		{ UP(x, {ma*ma - Rational(1), MP(0), MP(1)}), UP(x, {mb, ma}) },
+		// Rational coefficients and different degrees
+		{ UP(x, {Rational(Rational(1)/3) * mb, ma, MP(0), Rational(Rational(2)/5) * ma * mb + Rational(1)}), UP(x, {ma - mb, MP(Rational(Rational(3)/2))}) },
+		{ UP(x, {MP(2), ma, mb}), UP(x, {ma*mb, MP(-1), ma*ma, MP(1)}) },
+		// Common factor
+		{ UP(x, {-ma, MP(0), MP(1)}) * UP(x, {mb, MP(1)}), UP(x, {-ma, MP(0), MP(1)}) * UP(x, {MP(1), ma}) },
+		// No coefficient variables
+		{ UP(x, {MP(-2), MP(0), MP(1)}), UP(x, {MP(-3), MP(0), MP(0), MP(7)}) }
+	};
+	for (const auto& in: inputs) {
+		auto expected = carl::resultant(in.first, in.second, SubresultantStrategy::Lazard);
+		EXPECT_EQ(expected, carl::resultant(in.first, in.second, SubresultantStrategy::Modular));
+		EXPECT_EQ(carl::discriminant(in.first, SubresultantStrategy::Lazard), carl::discriminant(in.first, SubresultantStrategy::Modular));
+	}
+}
@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <carl/core/VariablePool.h>
+#include <carl/core/SignFilter.h>
+#include <carl/core/UnivariatePolynomial.h>
+
+#include "../Common.h"
+
+template<typename T>
+class SignFilterTest: public testing::Test {};
+
+TYPED_TEST_CASE(SignFilterTest, RationalTypes);
+
+TYPED_TEST(SignFilterTest, DecidedByFilter) {
+	carl::Variable x = carl::freshRealVariable("x");
+	// (x-1)*(x-2) = x^2 - 3x + 2
+	carl::UnivariatePolynomial<TypeParam> p(x, {2, -3, 1});
+	auto& stats = carl::SignFilterStatistics::getInstance();
+	stats.reset();
+	EXPECT_EQ(carl::Sign::POSITIVE, p.sgn(TypeParam(0)));
+	EXPECT_EQ(carl::Sign::NEGATIVE, p.sgn(TypeParam(3)/2));
+	EXPECT_EQ(carl::Sign::POSITIVE, p.sgn(TypeParam(5)));
+	EXPECT_EQ(std::size_t(3), stats.succeeded());
+	EXPECT_EQ(std::size_t(0), stats.failed());
+}
+
+TYPED_TEST(SignFilterTest, ExactFallback) {
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::UnivariatePolynomial<TypeParam> p(x, {2, -3, 1});
+	auto& stats = carl::SignFilterStatistics::getInstance();
+	stats.reset();
+	EXPECT_TRUE(p.isRoot(TypeParam(1)));
+	EXPECT_TRUE(p.isRoot(TypeParam(2)));
+	EXPECT_EQ(std::size_t(2), stats.failed());
+	// Close to a root, the enclosure contains zero while the exact value does not.
+	TypeParam eps = TypeParam(1) / TypeParam("100000000000000000000000000000000");
+	EXPECT_EQ(carl::Sign::NEGATIVE, p.sgn(TypeParam(1) + eps));
+	EXPECT_EQ(carl::Sign::POSITIVE, p.sgn(TypeParam(1) - eps));
+	EXPECT_EQ(std::size_t(4), stats.failed());
+}
+
+TYPED_TEST(SignFilterTest, IntervalSign) {
+	std::vector<TypeParam> coeffs({2, -3, 1});
+	auto s = carl::filteredIntervalSign(coeffs, TypeParam(3), TypeParam(4));
+	ASSERT_TRUE(bool(s));
+	EXPECT_EQ(carl::Sign::POSITIVE, *s);
+	s = carl::filteredIntervalSign(coeffs, TypeParam(TypeParam(29)/20), TypeParam(TypeParam(31)/20));
+	ASSERT_TRUE(bool(s));
+	EXPECT_EQ(carl::Sign::NEGATIVE, *s);
+	EXPECT_FALSE(bool(carl::filteredIntervalSign(coeffs, TypeParam(0), TypeParam(3))));
+}
+
+TYPED_TEST(SignFilterTest, CountRealRoots) {
+	carl::Variable x = carl::freshRealVariable("x");
+	carl::UnivariatePolynomial<TypeParam> p(x, {2, -3, 1});
+	EXPECT_EQ(2, p.countRealRoots(carl::Interval<TypeParam>(0, carl::BoundType::STRICT, 3, carl::BoundType::STRICT)));
+	EXPECT_EQ(1, p.countRealRoots(carl::Interval<TypeParam>(TypeParam(3)/2, carl::BoundType::STRICT, 3, carl::BoundType::STRICT)));
+}
@@ -0,0 +1,59 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/UnivariatePolynomial.h"
+#include "carl/core/UnivariatePolynomialCache.h"
+#include "carl/formula/model/ran/RealAlgebraicNumber.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(UnivariatePolynomialCache, Information)
+{
+	Variable x = freshRealVariable("x");
+	// (x^2 - 2) * (x - 1)^2
+	UnivariatePolynomial<Rational> p(x, {-2, 4, -1, -2, 1});
+	UnivariatePolynomialInformation<Rational> info(p);
+	EXPECT_EQ(p.derivative(), info.derivative());
+	EXPECT_EQ(p.standardSturmSequence(), info.sturmSequence());
+	EXPECT_EQ(&info.sturmSequence(), &info.sturmSequence());
+	EXPECT_EQ(UnivariatePolynomial<Rational>(x, {2, -2, -1, 1}), info.squareFreePart());
+	EXPECT_EQ(carl::cauchyBound(p), info.cauchyBound());
+
+	UnivariatePolynomial<Rational> q(x, {-1, 1});
+	auto seq = info.sturmSequence(q);
+	EXPECT_EQ(p.standardSturmSequence(p.derivative() * q), *seq);
+	EXPECT_EQ(seq, info.sturmSequence(q));
+}
+
+TEST(UnivariatePolynomialCache, Bounded)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomialCache<Rational> cache(2);
+	UnivariatePolynomial<Rational> p1(x, {-2, 0, 1});
+	UnivariatePolynomial<Rational> p2(x, {-3, 0, 1});
+	UnivariatePolynomial<Rational> p3(x, {-5, 0, 1});
+	auto i1 = cache.get(p1);
+	EXPECT_EQ(i1, cache.get(p1));
+	cache.get(p2);
+	cache.get(p1);
+	cache.get(p3);
+	EXPECT_EQ(std::size_t(2), cache.size());
+	// p2 was least recently used and dropped, p1 is still cached.
+	EXPECT_EQ(i1, cache.get(p1));
+	auto misses = cache.misses();
+	cache.get(p2);
+	EXPECT_EQ(misses + 1, cache.misses());
+}
+
+TEST(UnivariatePolynomialCache, SharedByRANs)
+{
+	Variable x = freshRealVariable("x");
+	UnivariatePolynomial<Rational> p(x, {-2, 0, 1});
+	RealAlgebraicNumber<Rational> neg(p, Interval<Rational>(-2, BoundType::STRICT, -1, BoundType::STRICT));
+	RealAlgebraicNumber<Rational> pos(p, Interval<Rational>(1, BoundType::STRICT, 2, BoundType::STRICT));
+	EXPECT_EQ(&neg.getIRSturmSequence(), &pos.getIRSturmSequence());
+	EXPECT_TRUE(neg < pos);
+	EXPECT_EQ(Sign::NEGATIVE, neg.sgn(UnivariatePolynomial<Rational>(x, {0, 1})));
+	EXPECT_EQ(Sign::POSITIVE, pos.sgn(UnivariatePolynomial<Rational>(x, {0, 1})));
+}
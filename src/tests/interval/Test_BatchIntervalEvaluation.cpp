@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariateHorner.h"
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/interval/BatchIntervalEvaluation.h"
+#include "carl/interval/IntervalEvaluation.h"
+
+#include "../Common.h"
+
+#include <random>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+class BatchIntervalEvaluationTest: public ::testing::Test {
+protected:
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	// x^2*y - 3/2*x*z^3 + y^2 + 7
+	Poly p = Poly(x)*x*y - Rational(Rational(3)/2)*Poly(x)*z*z*z + Poly(y)*y + Rational(7);
+
+	std::vector<std::map<Variable, Interval<double>>> randomBoxes(std::size_t n) {
+		std::mt19937 rand(4);
+		std::uniform_real_distribution<double> dist(-2, 2);
+		std::uniform_real_distribution<double> width(0, 0.5);
+		std::vector<std::map<Variable, Interval<double>>> res;
+		for (std::size_t i = 0; i < n; i++) {
+			std::map<Variable, Interval<double>> box;
+			for (auto v: {x, y, z}) {
+				double l = dist(rand);
+				box.emplace(v, Interval<double>(l, BoundType::WEAK, l + width(rand), BoundType::WEAK));
+			}
+			res.push_back(box);
+		}
+		return res;
+	}
+};
+
+TEST_F(BatchIntervalEvaluationTest, Polynomial)
+{
+	// More boxes than fit into a single block.
+	auto boxes = randomBoxes(600);
+	IntervalBoxes soa({z, y, x});
+	for (const auto& b: boxes) soa.add(b);
+	EXPECT_EQ(std::size_t(600), soa.size());
+
+	BatchIntervalEvaluation eval(p);
+	auto res = eval.evaluate(soa);
+	ASSERT_EQ(boxes.size(), res.size());
+	for (std::size_t i = 0; i < boxes.size(); i++) {
+		auto expected = IntervalEvaluation::evaluate(p, boxes[i]);
+		// Both are enclosures of the same term-wise evaluation, differing only by rounding.
+		EXPECT_NEAR(expected.lower(), res[i].lower(), 1e-12);
+		EXPECT_NEAR(expected.upper(), res[i].upper(), 1e-12);
+		EXPECT_LE(res[i].lower(), expected.lower());
+		EXPECT_GE(res[i].upper(), expected.upper());
+	}
+}
+
+TEST_F(BatchIntervalEvaluationTest, Horner)
+{
+	auto boxes = randomBoxes(300);
+	IntervalBoxes soa({x, y, z});
+	for (const auto& b: boxes) soa.add(b);
+
+	MultivariateHorner<Poly, strategy> horner(p);
+	BatchIntervalEvaluation eval(horner);
+	auto res = eval.evaluate(soa);
+	for (std::size_t i = 0; i < boxes.size(); i++) {
+		auto expected = IntervalEvaluation::evaluate(horner, boxes[i]);
+		EXPECT_NEAR(expected.lower(), res[i].lower(), 1e-12);
+		EXPECT_NEAR(expected.upper(), res[i].upper(), 1e-12);
+	}
+}
+
+TEST_F(BatchIntervalEvaluationTest, Special)
+{
+	IntervalBoxes soa({x});
+	soa.add(std::map<Variable, NativeInterval>({{x, NativeInterval(-1, 1)}}));
+	soa.add(std::map<Variable, NativeInterval>({{x, NativeInterval(0, std::numeric_limits<double>::infinity())}}));
+	auto res = BatchIntervalEvaluation(Poly(x)*x - Rational(1)).evaluate(soa);
+	EXPECT_TRUE(res[0].contains(-1) && res[0].contains(0));
+	EXPECT_GT(-0.99, res[0].lower());
+	EXPECT_LT(-1.01, res[0].lower());
+	EXPECT_EQ(std::numeric_limits<double>::infinity(), res[1].upper());
+	res = BatchIntervalEvaluation(Poly(Rational(3))).evaluate(soa);
+	EXPECT_TRUE(res[0].contains(3));
+	EXPECT_TRUE(res[1].contains(3));
+}
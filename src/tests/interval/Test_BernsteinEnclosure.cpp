@@ -0,0 +1,74 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/BernsteinEnclosure.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+namespace {
+	Interval<Rational> closed(Rational lower, Rational upper) {
+		return Interval<Rational>(lower, BoundType::WEAK, upper, BoundType::WEAK);
+	}
+}
+
+TEST(BernsteinEnclosure, Univariate)
+{
+	Variable x = freshRealVariable("x");
+	Poly p = Poly(x)*x - Rational(2)*x + Rational(1);
+	BernsteinEnclosure<Poly> b(p, {{x, closed(0, 2)}});
+	EXPECT_EQ(std::vector<Rational>({1, -1, 1}), b.coefficients());
+	EXPECT_EQ(closed(-1, 1), b.range());
+	EXPECT_FALSE(b.isLowerBoundTight());
+	EXPECT_TRUE(b.isUpperBoundTight());
+	EXPECT_FALSE(b.sign());
+
+	auto halves = b.split(x);
+	EXPECT_EQ(closed(0, 1), halves.first.interval(x));
+	EXPECT_EQ(std::vector<Rational>({1, 0, 0}), halves.first.coefficients());
+	EXPECT_TRUE(halves.first.isTight());
+	EXPECT_EQ(closed(0, 1), halves.second.range());
+}
+
+TEST(BernsteinEnclosure, Sign)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x)*y - Rational(1);
+	BernsteinEnclosure<Poly> pos(p, {{x, closed(2, 3)}, {y, closed(1, 2)}});
+	EXPECT_EQ(closed(1, 5), pos.range());
+	EXPECT_TRUE(pos.isTight());
+	EXPECT_EQ(Sign::POSITIVE, *pos.sign());
+	BernsteinEnclosure<Poly> neg(p, {{x, closed(-1, Rational(1)/2)}, {y, closed(0, 1)}});
+	EXPECT_EQ(Sign::NEGATIVE, *neg.sign());
+
+	// Naive interval evaluation of x^2 - 2xy + y^2 + 1 on [0,1]^2 yields [-1,3].
+	Poly q = Poly(x)*x - Rational(2)*x*y + Poly(y)*y + Rational(1);
+	BernsteinEnclosure<Poly> b(q, {{x, closed(0, 1)}, {y, closed(0, 1)}});
+	EXPECT_EQ(Sign::POSITIVE, *b.sign());
+}
+
+TEST(BernsteinEnclosure, Subdivision)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Poly p = Poly(x)*x*y - Rational(3)*x*y*y + Rational(2)*y - Rational(1, 2);
+	BernsteinEnclosure<Poly> b(p, {{x, closed(-1, 3)}, {y, closed(-2, 2)}});
+	auto halves = b.split(y);
+	BernsteinEnclosure<Poly> lower(p, {{x, closed(-1, 3)}, {y, closed(-2, 0)}});
+	BernsteinEnclosure<Poly> upper(p, {{x, closed(-1, 3)}, {y, closed(0, 2)}});
+	EXPECT_EQ(lower.coefficients(), halves.first.coefficients());
+	EXPECT_EQ(upper.coefficients(), halves.second.coefficients());
+	EXPECT_TRUE(b.range().contains(halves.first.range()));
+	EXPECT_TRUE(b.range().contains(halves.second.range()));
+	// The enclosure contains the values at some points.
+	for (Rational vx: {Rational(-1), Rational(0), Rational(5, 2)}) {
+		for (Rational vy: {Rational(-2), Rational(1, 3), Rational(2)}) {
+			EXPECT_TRUE(b.range().contains(p.evaluate({{x, vx}, {y, vy}})));
+		}
+	}
+}
@@ -0,0 +1,84 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/CenteredEvaluation.h"
+#include "carl/interval/Contraction.h"
+
+#include "../Common.h"
+
+#include <random>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+struct CenteredEvaluationTest: ::testing::Test {
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// (x - y)^2 * x + 3 x y - 2
+	Poly p = (Poly(x) - y) * (Poly(x) - y) * x + Rational(3) * x * y - Rational(2);
+	const std::vector<IntervalEvaluationForm> forms = {
+		IntervalEvaluationForm::Natural, IntervalEvaluationForm::MeanValue, IntervalEvaluationForm::Centered, IntervalEvaluationForm::Taylor
+	};
+
+	Interval<double>::evalintervalmap box(double cx, double cy, double radius) const {
+		return {
+			{x, Interval<double>(cx - radius, BoundType::WEAK, cx + radius, BoundType::WEAK)},
+			{y, Interval<double>(cy - radius, BoundType::WEAK, cy + radius, BoundType::WEAK)}
+		};
+	}
+};
+
+TEST_F(CenteredEvaluationTest, Enclosure)
+{
+	std::mt19937 rand(7);
+	std::uniform_real_distribution<double> dist(-3, 3);
+	std::uniform_real_distribution<double> unit(0, 1);
+	CenteredEvaluation<Poly> eval(p);
+	for (std::size_t n = 0; n < 50; n++) {
+		double radius = unit(rand) * 2;
+		auto b = box(dist(rand), dist(rand), radius);
+		IntervalBox<double> dense(b);
+		for (auto form: forms) {
+			auto res = eval.evaluate(b, form);
+			EXPECT_EQ(res, eval.evaluate(dense, form));
+			// Check points of the box, including the vertices.
+			for (double sx: {0.0, 0.3, 1.0}) {
+				for (double sy: {0.0, 0.7, 1.0}) {
+					Rational px = carl::rationalize<Rational>(b[x].lower() + sx * (b[x].upper() - b[x].lower()));
+					Rational py = carl::rationalize<Rational>(b[y].lower() + sy * (b[y].upper() - b[y].lower()));
+					Rational value = p.evaluate({{x, px}, {y, py}});
+					EXPECT_LE(carl::rationalize<Rational>(res.lower()), value) << form;
+					EXPECT_GE(carl::rationalize<Rational>(res.upper()), value) << form;
+				}
+			}
+		}
+	}
+}
+
+TEST_F(CenteredEvaluationTest, Tightness)
+{
+	CenteredEvaluation<Poly> eval(p);
+	auto b = box(1, 0.5, 0.01);
+	double natural = eval.evaluate(b, IntervalEvaluationForm::Natural).diameter();
+	EXPECT_GT(natural, eval.evaluate(b, IntervalEvaluationForm::MeanValue).diameter());
+	EXPECT_GT(natural, eval.evaluate(b, IntervalEvaluationForm::Centered).diameter());
+	EXPECT_GT(natural, eval.evaluate(b, IntervalEvaluationForm::Taylor).diameter());
+
+	// Unbounded boxes fall back to the natural form.
+	b[x] = Interval<double>::unboundedInterval();
+	EXPECT_EQ(eval.evaluate(b, IntervalEvaluationForm::Natural), eval.evaluate(b, IntervalEvaluationForm::Taylor));
+}
+
+TEST_F(CenteredEvaluationTest, Contraction)
+{
+	Contraction<SimpleNewton, Poly> contractor(p);
+	CenteredEvaluation<Poly> eval(p);
+	auto b = box(1, 0.5, 0.5);
+	Interval<double> resA, resB;
+	contractor(b, x, resA, resB);
+	for (auto form: forms) {
+		EXPECT_EQ(eval.evaluate(b, form), contractor.evaluate(b, form));
+	}
+}
@@ -0,0 +1,120 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/ContractionEngine.h"
+
+#include "../Common.h"
+
+#include <cmath>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+struct ContractionEngineTest: ::testing::Test {
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// The only solution in the box is x = sqrt(2), y = 1/sqrt(2).
+	std::vector<Poly> constraints = { Poly(x)*x - Rational(2), Poly(x)*y - Rational(1) };
+
+	IntervalBox<double> box() const {
+		IntervalBox<double> res;
+		res.set(x, Interval<double>(0.1, 3.0));
+		res.set(y, Interval<double>(0.1, 3.0));
+		return res;
+	}
+};
+
+TEST_F(ContractionEngineTest, FixedPoint)
+{
+	ContractionEngine<Poly> engine(constraints);
+	auto b = box();
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_TRUE(b.at(x).contains(std::sqrt(2.0)));
+	EXPECT_TRUE(b.at(y).contains(std::sqrt(0.5)));
+	for (auto v: {x, y}) {
+		EXPECT_GT(1e-6, b.at(v).diameter());
+	}
+	const auto& stats = engine.statistics();
+	EXPECT_LT(std::size_t(0), stats.reductions);
+	EXPECT_GE(stats.contractions, stats.reductions);
+	EXPECT_GT(1e-5, stats.relativeWidth);
+}
+
+TEST_F(ContractionEngineTest, Infeasible)
+{
+	ContractionEngine<Poly> engine({ Poly(x) + y - Rational(7) });
+	auto b = box();
+	EXPECT_FALSE(engine.contract(b));
+	EXPECT_EQ(0, engine.statistics().relativeWidth);
+}
+
+TEST_F(ContractionEngineTest, Budget)
+{
+	ContractionEngine<Poly>::Settings settings;
+	settings.maxContractions = 3;
+	ContractionEngine<Poly> engine(constraints, settings);
+	auto b = box();
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_EQ(std::size_t(3), engine.statistics().contractions);
+}
+
+TEST_F(ContractionEngineTest, Parallel)
+{
+	ContractionEngine<Poly>::Settings settings;
+	settings.threads = 4;
+	ContractionEngine<Poly> engine(constraints, settings);
+	auto b = box();
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_TRUE(b.at(x).contains(std::sqrt(2.0)));
+	EXPECT_TRUE(b.at(y).contains(std::sqrt(0.5)));
+	for (auto v: {x, y}) {
+		EXPECT_GT(1e-6, b.at(v).diameter());
+	}
+}
+
+TEST_F(ContractionEngineTest, HC4)
+{
+	ContractionEngine<Poly>::Settings settings;
+	settings.useHC4 = true;
+	ContractionEngine<Poly> engine(constraints, settings);
+	auto b = box();
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_TRUE(b.at(x).contains(std::sqrt(2.0)));
+	EXPECT_TRUE(b.at(y).contains(std::sqrt(0.5)));
+	for (auto v: {x, y}) {
+		EXPECT_GT(1e-6, b.at(v).diameter());
+	}
+}
+
+TEST_F(ContractionEngineTest, UnboundedHC4)
+{
+	// x = y^2 + z with y in [1,2] and z >= 0 only bounds x from below.
+	Variable z = freshRealVariable("z");
+	ContractionEngine<Poly>::Settings settings;
+	settings.useHC4 = true;
+	ContractionEngine<Poly> engine({ Poly(x) - Poly(y)*y - z }, settings);
+	IntervalBox<double> b;
+	b.set(x, Interval<double>::unboundedInterval());
+	b.set(y, Interval<double>(1.0, 2.0));
+	b.set(z, Interval<double>(0.0, BoundType::WEAK, 0.0, BoundType::INFTY));
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_EQ(BoundType::INFTY, b.at(x).upperBoundType());
+	EXPECT_NE(BoundType::INFTY, b.at(x).lowerBoundType());
+	EXPECT_GT(1e-9, std::abs(b.at(x).lower() - 1.0));
+	EXPECT_LT(std::size_t(0), engine.statistics().reductions);
+}
+
+TEST_F(ContractionEngineTest, UnboundedNewton)
+{
+	// x = y with x <= 5 and y <= 3 narrows the upper bound of x.
+	ContractionEngine<Poly> engine({ Poly(x) - y });
+	IntervalBox<double> b;
+	b.set(x, Interval<double>(0.0, BoundType::INFTY, 5.0, BoundType::WEAK));
+	b.set(y, Interval<double>(0.0, BoundType::INFTY, 3.0, BoundType::WEAK));
+	EXPECT_TRUE(engine.contract(b));
+	EXPECT_EQ(BoundType::INFTY, b.at(x).lowerBoundType());
+	EXPECT_NE(BoundType::INFTY, b.at(x).upperBoundType());
+	EXPECT_GT(1e-9, std::abs(b.at(x).upper() - 3.0));
+}
@@ -0,0 +1,70 @@
+#include "gtest/gtest.h"
+
+#include "carl/interval/DyadicInterval.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using DyadicInterval = Interval<Dyadic>;
+
+TEST(DyadicInterval, Arithmetic)
+{
+	DyadicInterval a(Dyadic(1), BoundType::WEAK, Dyadic(2), BoundType::WEAK);
+	DyadicInterval b(Dyadic(-1), BoundType::WEAK, Dyadic(mpz_class(1), -1), BoundType::STRICT);
+	EXPECT_EQ(toRationalInterval(a + b), Interval<mpq_class>(mpq_class(0), BoundType::WEAK, mpq_class(5, 2), BoundType::STRICT));
+	EXPECT_EQ(toRationalInterval(a * b), Interval<mpq_class>(mpq_class(-2), BoundType::WEAK, mpq_class(1), BoundType::STRICT));
+	EXPECT_EQ(toRationalInterval(a.pow(2)), Interval<mpq_class>(mpq_class(1), BoundType::WEAK, mpq_class(4), BoundType::WEAK));
+	EXPECT_EQ(Dyadic(mpz_class(3), -1), a.center());
+	EXPECT_TRUE(a.contains(Dyadic(mpz_class(3), -1)));
+
+	// Division is rounded outwards.
+	DyadicInterval three(Dyadic(3));
+	DyadicInterval q;
+	a.div_ext(three, q, q);
+	auto exact = Interval<mpq_class>(mpq_class(1, 3), BoundType::WEAK, mpq_class(2, 3), BoundType::WEAK);
+	EXPECT_TRUE(toRationalInterval(q).contains(exact));
+	EXPECT_GE(Dyadic::precision(), q.lower().bitSize());
+	EXPECT_GE(Dyadic::precision(), q.upper().bitSize());
+}
+
+TEST(DyadicInterval, BoundedSize)
+{
+	// Repeated squaring doubles the size of exact endpoints, but dyadic endpoints keep the precision.
+	Interval<mpq_class> exact(mpq_class(9, 10), BoundType::WEAK, mpq_class(11, 10), BoundType::WEAK);
+	DyadicInterval i = toDyadicInterval(exact);
+	for (std::size_t n = 0; n < 8; n++) {
+		exact = exact * exact;
+		i = i * i;
+		EXPECT_TRUE(toRationalInterval(i).contains(exact));
+		EXPECT_GE(Dyadic::precision(), i.lower().bitSize());
+		EXPECT_GE(Dyadic::precision(), i.upper().bitSize());
+	}
+	EXPECT_LT(std::size_t(500), exact.upper().get_den().get_str(2).size());
+}
+
+TEST(DyadicInterval, Conversion)
+{
+	Interval<mpq_class> third(mpq_class(1, 3), BoundType::STRICT, mpq_class(2, 3), BoundType::WEAK);
+	auto d = toDyadicInterval(third, 8);
+	EXPECT_TRUE(toRationalInterval(d).contains(third));
+	EXPECT_EQ(BoundType::STRICT, d.lowerBoundType());
+	EXPECT_EQ(BoundType::WEAK, d.upperBoundType());
+	EXPECT_GE(std::size_t(8), d.lower().bitSize());
+	EXPECT_GT(mpq_class(1, 100), toRationalInterval(d).diameter() - third.diameter());
+
+	auto fine = toDyadicInterval(third, 200);
+	auto coarse = roundOutward(fine, 8);
+	EXPECT_EQ(d, coarse);
+
+	auto dbl = toDoubleInterval(toDyadicInterval(third));
+	EXPECT_LE(dbl.lower(), 1.0 / 3);
+	EXPECT_GE(dbl.upper(), 2.0 / 3);
+	EXPECT_TRUE(Interval<mpq_class>(carl::rationalize<mpq_class>(dbl.lower()), carl::rationalize<mpq_class>(dbl.upper())).contains(third));
+
+	Interval<double> native(0.1, BoundType::WEAK, 0.0, BoundType::INFTY);
+	auto nd = toDyadicInterval(native);
+	EXPECT_EQ(BoundType::INFTY, nd.upperBoundType());
+	EXPECT_EQ(native, toDoubleInterval(nd));
+	EXPECT_TRUE(toDyadicInterval(Interval<double>::emptyInterval()).isEmpty());
+}
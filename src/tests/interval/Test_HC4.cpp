@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/HC4.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<Rational>;
+
+struct HC4Test: ::testing::Test {
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+};
+
+TEST_F(HC4Test, Linear)
+{
+	HC4<Poly> hc4(Poly(x) + y - Rational(3));
+	Interval<double>::evalintervalmap box = {
+		{x, Interval<double>(0.0, 10.0)},
+		{y, Interval<double>(0.0, 1.0)}
+	};
+	EXPECT_TRUE(hc4.revise(box));
+	EXPECT_EQ(Interval<double>(2.0, 3.0), box[x]);
+	EXPECT_EQ(Interval<double>(0.0, 1.0), box[y]);
+}
+
+TEST_F(HC4Test, Nonlinear)
+{
+	// The negative root is found from the even power.
+	HC4<Poly> square(Poly(x) * x - Rational(4));
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(-5.0, 1.0));
+	EXPECT_TRUE(square.revise(box));
+	EXPECT_TRUE(box.at(x).contains(-2.0));
+	EXPECT_GT(1e-10, box.at(x).diameter());
+
+	// x * y <= 1 bounds y from above.
+	HC4<Poly> product(Poly(x) * y - Rational(1), Relation::LEQ);
+	box.set(x, Interval<double>(2.0, 4.0));
+	box.set(y, Interval<double>(0.0, 10.0));
+	EXPECT_TRUE(product.revise(box));
+	EXPECT_EQ(Interval<double>(2.0, 4.0), box.at(x));
+	EXPECT_EQ(Interval<double>(0.0, 0.5), box.at(y));
+
+	// Same interface as Contraction.
+	box.set(y, Interval<double>(0.0, 10.0));
+	Interval<double> resA, resB;
+	EXPECT_FALSE(product(box, y, resA, resB));
+	EXPECT_EQ(Interval<double>(0.0, 0.5), resA);
+}
+
+TEST_F(HC4Test, Infeasible)
+{
+	HC4<Poly> hc4(Poly(x) * x + Poly(y) * y + Rational(1));
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(-1.0, 1.0));
+	box.set(y, Interval<double>::unboundedInterval());
+	EXPECT_FALSE(hc4.revise(box));
+
+	HC4<Poly> greater(Poly(x) - Rational(2), Relation::GREATER);
+	Interval<double> resA, resB;
+	greater(box, x, resA, resB);
+	EXPECT_TRUE(resA.isEmpty());
+}
+
+TEST_F(HC4Test, SharedPowers)
+{
+	// x^2 is shared among the first two terms: x, y, z, x^2, three terms and the sum.
+	HC4<Poly> hc4(Poly(x) * x * y + Poly(x) * x * z + Poly(x));
+	EXPECT_EQ(std::size_t(8), hc4.size());
+}
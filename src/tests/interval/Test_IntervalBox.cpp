@@ -0,0 +1,89 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariateHorner.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/Contraction.h"
+#include "carl/interval/IntervalBox.h"
+#include "carl/interval/IntervalEvaluation.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+TEST(IntervalBox, Basics)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable i = freshIntegerVariable("i");
+	IntervalBox<double> box;
+	EXPECT_FALSE(box.has(x));
+	box.set(x, Interval<double>(1, 2));
+	box.set(i, Interval<double>(-3, 3));
+	EXPECT_TRUE(box.has(x));
+	EXPECT_FALSE(box.has(y));
+	EXPECT_TRUE(box.has(i));
+	EXPECT_EQ(Interval<double>(1, 2), box.at(x));
+	EXPECT_EQ(Interval<double>(-3, 3), box.at(i));
+	box.erase(i);
+	EXPECT_FALSE(box.has(i));
+	EXPECT_EQ(std::size_t(1), box.toMap().size());
+
+	Interval<double>::evalintervalmap map = {{x, Interval<double>(0, 1)}, {y, Interval<double>(2, 3)}};
+	IntervalBox<double> fromMap(map);
+	EXPECT_EQ(map, fromMap.toMap());
+}
+
+TEST(IntervalBox, Overlay)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	Variable z = freshRealVariable("z");
+	IntervalBox<double> box;
+	box.set(x, Interval<double>(1, 2));
+	box.set(y, Interval<double>(3, 4));
+	auto overlay = box.overlay(x, Interval<double>(5));
+	EXPECT_TRUE(overlay.isOverlay());
+	EXPECT_EQ(Interval<double>(5), overlay.at(x));
+	EXPECT_EQ(Interval<double>(3, 4), overlay.at(y));
+	EXPECT_EQ(Interval<double>(1, 2), box.at(x));
+	EXPECT_FALSE(overlay.has(z));
+	auto nested = overlay.overlay(z, Interval<double>(0, 1));
+	EXPECT_TRUE(nested.has(z));
+	EXPECT_EQ(Interval<double>(5), nested.at(x));
+	EXPECT_EQ(std::size_t(3), nested.toMap().size());
+}
+
+TEST(IntervalBox, Evaluation)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	MultivariatePolynomial<Rational> p = Rational(3)*x*x*y - Rational(2)*y + Rational(1);
+	MultivariateHorner<MultivariatePolynomial<Rational>, strategy> horner(p);
+	Interval<double>::evalintervalmap map = {{x, Interval<double>(-1, 2)}, {y, Interval<double>(0.5, 3.0)}};
+	IntervalBox<double> box(map);
+	EXPECT_EQ(IntervalEvaluation::evaluate(p, map), IntervalEvaluation::evaluate(p, box));
+	EXPECT_EQ(IntervalEvaluation::evaluate(horner, map), IntervalEvaluation::evaluate(horner, box));
+
+	map[x] = Interval<double>(1);
+	EXPECT_EQ(IntervalEvaluation::evaluate(p, map), IntervalEvaluation::evaluate(p, box.overlay(x, Interval<double>(1))));
+}
+
+TEST(IntervalBox, Contraction)
+{
+	Variable a = freshRealVariable("a");
+	Variable b = freshRealVariable("b");
+	Variable c = freshRealVariable("c");
+	Interval<double>::evalintervalmap map = {{a, Interval<double>(1, 4)}, {b, Interval<double>(2, 5)}, {c, Interval<double>(-2, 3)}};
+	IntervalBox<double> box(map);
+	MultivariatePolynomial<Rational> p = Rational(12)*a + Rational(3)*b + MultivariatePolynomial<Rational>(c)*c - Rational(20);
+
+	Contraction<SimpleNewton, MultivariatePolynomial<Rational>> contractor(p);
+	for (auto v: {a, b, c}) {
+		Interval<double> mapA, mapB, boxA, boxB;
+		bool mapSplit = contractor(map, v, mapA, mapB);
+		bool boxSplit = contractor(box, v, boxA, boxB);
+		EXPECT_EQ(mapSplit, boxSplit);
+		EXPECT_EQ(mapA, boxA);
+		if (mapSplit) EXPECT_EQ(mapB, boxB);
+	}
+}
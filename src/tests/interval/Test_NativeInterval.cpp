@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include "carl/interval/NativeInterval.h"
+
+#include "../Common.h"
+
+using namespace carl;
+
+namespace {
+	/// Checks whether i contains [lower,upper] and is only larger by a small relative error.
+	::testing::AssertionResult tightlyEncloses(const NativeInterval& i, double lower, double upper) {
+		if (!(i.lower() <= lower && upper <= i.upper())) {
+			return ::testing::AssertionFailure() << i << " does not contain [" << lower << ", " << upper << "]";
+		}
+		if (lower - i.lower() > 1e-14 * std::max(1.0, std::abs(lower))) {
+			return ::testing::AssertionFailure() << "Lower bound of " << i << " is too small";
+		}
+		if (i.upper() - upper > 1e-14 * std::max(1.0, std::abs(upper))) {
+			return ::testing::AssertionFailure() << "Upper bound of " << i << " is too large";
+		}
+		return ::testing::AssertionSuccess();
+	}
+}
+
+TEST(NativeInterval, Basics)
+{
+	NativeInterval i(-1, 2);
+	EXPECT_EQ(-1, i.lower());
+	EXPECT_EQ(2, i.upper());
+	EXPECT_TRUE(i.contains(0));
+	EXPECT_FALSE(i.contains(3));
+	EXPECT_TRUE(NativeInterval(1, 0).isEmpty());
+	EXPECT_TRUE(NativeInterval::emptyInterval().isEmpty());
+	EXPECT_TRUE(NativeInterval::unboundedInterval().isUnbounded());
+	EXPECT_EQ(NativeInterval(0, 1), NativeInterval(-1, 1).intersect(NativeInterval(0, 2)));
+	EXPECT_TRUE(NativeInterval(-1, 0).intersect(NativeInterval(1, 2)).isEmpty());
+	EXPECT_EQ(NativeInterval(-1, 2), NativeInterval(-1, 0).convexHull(NativeInterval(1, 2)));
+}
+
+TEST(NativeInterval, Conversion)
+{
+	Interval<double> i(1, BoundType::STRICT, 2, BoundType::WEAK);
+	EXPECT_EQ(NativeInterval(1, 2), NativeInterval(i));
+	EXPECT_TRUE(NativeInterval(Interval<double>::unboundedInterval()).isUnbounded());
+	EXPECT_TRUE(NativeInterval(Interval<double>::emptyInterval()).isEmpty());
+	EXPECT_EQ(Interval<double>(1, BoundType::WEAK, 2, BoundType::WEAK), NativeInterval(1, 2).toInterval());
+	EXPECT_EQ(Interval<double>(1, BoundType::WEAK, 0, BoundType::INFTY), NativeInterval(1, std::numeric_limits<double>::infinity()).toInterval());
+}
+
+TEST(NativeInterval, Arithmetic)
+{
+	NativeInterval a(1, 2);
+	NativeInterval b(-3, 5);
+	EXPECT_TRUE(tightlyEncloses(a + b, -2, 7));
+	EXPECT_TRUE(tightlyEncloses(a - b, -4, 5));
+	EXPECT_TRUE(tightlyEncloses(-a, -2, -1));
+	EXPECT_TRUE(tightlyEncloses(a * b, -6, 10));
+	EXPECT_TRUE(tightlyEncloses(b * b, -15, 25));
+	EXPECT_TRUE(tightlyEncloses(b / a, -3, 5));
+	EXPECT_TRUE(tightlyEncloses(a / NativeInterval(-4, -2), -1, -0.25));
+	EXPECT_TRUE((a / b).isUnbounded());
+	EXPECT_TRUE((NativeInterval(0) / b).isZero());
+
+	// 0.1 is not representable, the result must still contain the exact sum.
+	NativeInterval tenth(0.1);
+	NativeInterval sum;
+	for (int i = 0; i < 10; i++) sum += tenth;
+	EXPECT_LE(sum.lower(), 1.0);
+	EXPECT_LT(1.0, sum.upper());
+	EXPECT_GT(1e-14, sum.diameter());
+}
+
+TEST(NativeInterval, Unbounded)
+{
+	double inf = std::numeric_limits<double>::infinity();
+	NativeInterval pos(1, inf);
+	auto r = pos * NativeInterval(1, 2);
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(r.lower(), 1), 1, 1));
+	EXPECT_EQ(inf, r.upper());
+	EXPECT_TRUE((pos * NativeInterval(-1, 1)).isUnbounded());
+	// The product of the bounds 0 and infinity is ignored.
+	r = NativeInterval(0, 1) * pos;
+	EXPECT_GE(0, r.lower());
+	EXPECT_LT(-1e-300, r.lower());
+	EXPECT_EQ(inf, r.upper());
+	EXPECT_TRUE((NativeInterval(0) * NativeInterval::unboundedInterval()).isZero());
+	r = pos / pos;
+	EXPECT_GE(0, r.lower());
+	EXPECT_EQ(inf, r.upper());
+}
+
+TEST(NativeInterval, Power)
+{
+	EXPECT_EQ(NativeInterval(1), NativeInterval(-3, 2).pow(0));
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(-3, 2).pow(2), 0, 9));
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(-3, 2).pow(3), -27, 8));
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(-3, -2).pow(2), 4, 9));
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(-3, -2).pow(3), -27, -8));
+	EXPECT_TRUE(tightlyEncloses(NativeInterval(2, 3).pow(5), 32, 243));
+	auto p = NativeInterval(0.1).pow(3);
+	EXPECT_TRUE(p.lower() <= 0.1 * 0.1 * 0.1 && 0.1 * 0.1 * 0.1 <= p.upper());
+	EXPECT_LE(0, NativeInterval(0, 1).pow(7).lower());
+}
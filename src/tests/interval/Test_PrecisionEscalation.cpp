@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+
+#include "carl/core/MultivariatePolynomial.h"
+#include "carl/core/VariablePool.h"
+#include "carl/interval/PrecisionEscalation.h"
+
+#include "../Common.h"
+
+#include <boost/optional/optional_io.hpp>
+
+using namespace carl;
+
+using Poly = MultivariatePolynomial<mpq_class>;
+
+TEST(PrecisionEscalation, Dyadic)
+{
+	Variable x = freshRealVariable("x");
+	Variable y = freshRealVariable("y");
+	// 3x - 1 is tiny at x = 1/3 + 2^-200, which is only decided with a precision of more than 200 bits.
+	mpq_class eps(mpz_class(1), mpz_class(1) << 200);
+	Poly p = mpq_class(3) * Poly(x) - mpq_class(1);
+	PrecisionEscalation<Dyadic, Poly> escalation(p);
+	std::size_t precision = Dyadic::precision();
+	EXPECT_EQ(Sign::POSITIVE, escalation.sign(std::map<Variable, mpq_class>({{x, mpq_class(1, 3) + eps}})));
+	EXPECT_EQ(Sign::NEGATIVE, escalation.sign(std::map<Variable, mpq_class>({{x, mpq_class(1, 3) - eps}})));
+	EXPECT_LT(std::size_t(200), escalation.precision());
+	EXPECT_LT(std::size_t(1), escalation.evaluations());
+	// The precision is restored.
+	EXPECT_EQ(precision, Dyadic::precision());
+
+	escalation.settings().maxPrecision = 128;
+	EXPECT_EQ(boost::none, escalation.sign(std::map<Variable, mpq_class>({{x, mpq_class(1, 3) + eps}})));
+	EXPECT_EQ(std::size_t(128), escalation.precision());
+
+	// Exactly representable zeros are detected.
+	PrecisionEscalation<Dyadic, Poly> half(Poly(x) * y - mpq_class(1, 8));
+	EXPECT_EQ(Sign::ZERO, half.sign(std::map<Variable, mpq_class>({{x, mpq_class(1, 2)}, {y, mpq_class(1, 4)}})));
+	EXPECT_EQ(std::size_t(1), half.evaluations());
+
+	// Boxes, e.g. isolating intervals, are decided if the polynomial has no root in them.
+	std::map<Variable, Interval<mpq_class>> box = {{x, Interval<mpq_class>(mpq_class(1, 3) + eps, mpq_class(1, 2))}};
+	escalation.settings().maxPrecision = 4096;
+	EXPECT_EQ(Sign::POSITIVE, escalation.sign(box));
+	auto range = escalation.evaluate(box, 64);
+	EXPECT_TRUE(toRationalInterval(range).contains(Interval<mpq_class>(mpq_class(3) * eps, mpq_class(1, 2))));
+}
@@ -0,0 +1,57 @@
+#include "gtest/gtest.h"
+
+#include "carl/numbers/numbers.h"
+
+#include <unordered_set>
+
+using namespace carl;
+
+TEST(Dyadic, Arithmetic)
+{
+	Dyadic a(mpz_class(3), -2); // 3/4
+	Dyadic b(mpz_class(5), 1); // 10
+	EXPECT_EQ(mpq_class(43, 4), (a + b).toRational());
+	EXPECT_EQ(mpq_class(-37, 4), (a - b).toRational());
+	EXPECT_EQ(mpq_class(15, 2), (a * b).toRational());
+	EXPECT_EQ(mpq_class(3, 8), (a / Dyadic(2)).toRational());
+	EXPECT_EQ(mpq_class(27, 64), carl::pow(a, 3).toRational());
+	EXPECT_TRUE(a < b);
+	EXPECT_TRUE(-b < a);
+	EXPECT_EQ(Dyadic(12), Dyadic(mpz_class(3), 2));
+	EXPECT_EQ(mpz_class(0), carl::floor(a));
+	EXPECT_EQ(mpz_class(1), carl::ceil(a));
+	EXPECT_EQ(mpz_class(-1), carl::floor(-a));
+	EXPECT_TRUE(carl::isInteger(b));
+	EXPECT_FALSE(carl::isInteger(a));
+	EXPECT_EQ(0.75, carl::toDouble(a));
+	EXPECT_EQ(Dyadic(0.1).toDouble(), 0.1);
+	// 2^54 + 3 is rounded to the nearest double, ties are rounded to even.
+	mpz_class large = mpz_class(1) << 54;
+	EXPECT_EQ(std::ldexp(1.0, 54) + 4, Dyadic(large + 3).toDouble());
+	EXPECT_EQ(-std::ldexp(1.0, 54) - 4, Dyadic(-large - 3).toDouble());
+	EXPECT_EQ(std::ldexp(1.0, 54), Dyadic(large + 2).toDouble());
+	EXPECT_EQ(std::ldexp(1.0, 54) + 8, Dyadic(large + 6).toDouble());
+
+	std::unordered_set<Dyadic> set = { a, b, Dyadic(mpz_class(6), -3) };
+	EXPECT_EQ(std::size_t(2), set.size());
+}
+
+TEST(Dyadic, Rounding)
+{
+	mpq_class third(1, 3);
+	Dyadic lower = Dyadic::roundDown(third, 10);
+	Dyadic upper = Dyadic::roundUp(third, 10);
+	EXPECT_LT(lower.toRational(), third);
+	EXPECT_GT(upper.toRational(), third);
+	EXPECT_GE(std::size_t(10), lower.bitSize());
+	EXPECT_GE(std::size_t(10), upper.bitSize());
+	EXPECT_GT(mpq_class(1, 1000), upper.toRational() - lower.toRational());
+	EXPECT_EQ(-upper, Dyadic::roundDown(-third, 10));
+	// Exact values are not changed.
+	EXPECT_EQ(Dyadic(mpz_class(3), -2), Dyadic::roundUp(mpq_class(3, 4), 10));
+
+	Dyadic big(mpz_class(1023), 0);
+	EXPECT_EQ(Dyadic(1024), big.round(4, true));
+	EXPECT_EQ(Dyadic(960), big.round(4, false));
+	EXPECT_EQ(Dyadic(-960), (-big).round(4, true));
+}